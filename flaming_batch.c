@@ -0,0 +1,278 @@
+#include "flaming_batch.h"
+#include "flaming_rules.h"
+#include <stdlib.h>
+#include <string.h>
+
+// === Bellek yönetimi ===
+bool SimBatchCreate(SimBatch *batch, int count, float screenWidth, float screenHeight) {
+    memset(batch, 0, sizeof(*batch));
+
+    size_t worlds = (size_t)count;
+    size_t obstacles = worlds * NUM_OBSTACLES;
+
+    batch->count = count;
+    batch->screenWidth = screenWidth;
+    batch->screenHeight = screenHeight;
+    batch->coreRadius = CORE_RADIUS;
+    batch->simdLevel = SimSimdDetect();
+    batch->fireballKernel = SimFireballKernel(batch->simdLevel);
+    batch->segmentKernel = SimSegmentKernel(batch->simdLevel);
+
+    batch->coreX = calloc(worlds, sizeof(float));
+    batch->coreY = calloc(worlds, sizeof(float));
+    batch->velocityX = calloc(worlds, sizeof(float));
+    batch->velocityY = calloc(worlds, sizeof(float));
+    batch->targetX = calloc(worlds, sizeof(float));
+    batch->targetY = calloc(worlds, sizeof(float));
+    batch->timeScale = calloc(worlds, sizeof(float));
+    batch->levelTime = calloc(worlds, sizeof(float));
+    batch->completionTime = calloc(worlds, sizeof(float));
+    batch->tick = calloc(worlds, sizeof(int));
+    batch->laserPhase = calloc(worlds, sizeof(uint32_t));
+    batch->aliveObstacles = calloc(worlds, sizeof(int));
+    batch->explodingObstacles = calloc(worlds, sizeof(int));
+    batch->fireballSlots = calloc(worlds * SIM_FIREBALL_WORDS, sizeof(uint64_t));
+    batch->fireballCapacity = calloc(worlds, sizeof(int));
+    batch->level = calloc(worlds, sizeof(uint8_t));
+    batch->flags = calloc(worlds, sizeof(uint8_t));
+
+    batch->obstacles = calloc(obstacles, sizeof(Obstacle));
+    batch->obstacleOrder = calloc(obstacles, sizeof(uint16_t));
+
+    batch->lasers = calloc(worlds, sizeof(LaserSet));
+    batch->shooters = calloc(worlds, sizeof(ShooterSet));
+    batch->fireballs = calloc(worlds, sizeof(FireballSet));
+
+    // Levellerin başlangıcını ve statik duvarlarını bir kez hazırla
+    batch->levelStarts = malloc(MAX_LEVELS * sizeof(GameWorld));
+    if (batch->levelStarts != NULL) {
+        for (int level = 0; level < MAX_LEVELS; level++) {
+            GameWorld *levelWorld = &batch->levelStarts[level];
+            DeadlyWall walls[MAX_DEADLY_WALLS];
+            int wallCount = 0;
+
+            SimInitWorld(levelWorld, level, screenWidth, screenHeight, 0);
+
+            // Duvarlar yalnızca level 3 ve sonrasında etkilidir
+            for (int i = 0; i < MAX_DEADLY_WALLS && level >= 2; i++) {
+                if (!levelWorld->deadlyWalls[i].active) continue;
+                walls[wallCount++] = levelWorld->deadlyWalls[i];
+            }
+
+            SimBuildWallSegments(&batch->wallSegments[level], walls, wallCount, batch->coreRadius);
+            SimGridBuild(&batch->grids[level], levelWorld->obstacles, NUM_OBSTACLES, walls, wallCount,
+                         screenWidth, screenHeight, batch->coreRadius);
+            batch->sdf[level] = SimWorldSdf(levelWorld);
+        }
+    }
+
+    if (!batch->levelStarts || !batch->coreX || !batch->coreY || !batch->velocityX || !batch->velocityY ||
+        !batch->targetX || !batch->targetY || !batch->timeScale || !batch->levelTime ||
+        !batch->completionTime || !batch->tick || !batch->laserPhase || !batch->aliveObstacles ||
+        !batch->explodingObstacles || !batch->fireballSlots || !batch->fireballCapacity ||
+        !batch->level || !batch->flags || !batch->obstacles || !batch->obstacleOrder ||
+        !batch->lasers || !batch->shooters || !batch->fireballs) {
+        SimBatchDestroy(batch);
+        return false;
+    }
+
+    return true;
+}
+
+void SimBatchDestroy(SimBatch *batch) {
+    free(batch->coreX);
+    free(batch->coreY);
+    free(batch->velocityX);
+    free(batch->velocityY);
+    free(batch->targetX);
+    free(batch->targetY);
+    free(batch->timeScale);
+    free(batch->levelTime);
+    free(batch->completionTime);
+    free(batch->tick);
+    free(batch->laserPhase);
+    free(batch->aliveObstacles);
+    free(batch->explodingObstacles);
+    free(batch->fireballSlots);
+    free(batch->fireballCapacity);
+    free(batch->level);
+    free(batch->flags);
+
+    free(batch->obstacles);
+    free(batch->obstacleOrder);
+
+    free(batch->lasers);
+    free(batch->shooters);
+    free(batch->fireballs);
+    free(batch->levelStarts);
+
+    memset(batch, 0, sizeof(*batch));
+}
+
+// === GameWorld ile dönüşüm ===
+bool SimBatchLoadWorld(SimBatch *batch, int index, const GameWorld *world) {
+    // Duvar tabloları, ızgaralar ve ateş topu sınırları batch'in ölçülerine göre
+    if (world->screenWidth != batch->screenWidth || world->screenHeight != batch->screenHeight ||
+        world->coreRadius != batch->coreRadius || world->level < 0 || world->level >= MAX_LEVELS) {
+        return false;
+    }
+
+    batch->coreX[index] = world->corePosition.x;
+    batch->coreY[index] = world->corePosition.y;
+    batch->velocityX[index] = world->velocity.x;
+    batch->velocityY[index] = world->velocity.y;
+    batch->targetX[index] = world->targetPosition.x;
+    batch->targetY[index] = world->targetPosition.y;
+    batch->timeScale[index] = world->timeScale;
+    batch->levelTime[index] = world->levelTime;
+    batch->completionTime[index] = world->completionTime;
+    batch->tick[index] = world->tick;
+    batch->laserPhase[index] = world->laserPhase;
+    batch->level[index] = (uint8_t)world->level;
+    batch->flags[index] = (world->aiming ? BATCH_FLAG_AIMING : 0) |
+                          (world->bulletTimeActive ? BATCH_FLAG_BULLET_TIME : 0) |
+                          (world->gameOver ? BATCH_FLAG_GAME_OVER : 0) |
+                          (world->victory ? BATCH_FLAG_VICTORY : 0);
+
+    int firstObstacle = index * NUM_OBSTACLES;
+    memcpy(batch->obstacles + firstObstacle, world->obstacles, sizeof(world->obstacles));
+    memcpy(batch->obstacleOrder + firstObstacle, world->obstacleOrder, sizeof(world->obstacleOrder));
+    batch->aliveObstacles[index] = world->aliveObstacles;
+    batch->explodingObstacles[index] = world->explodingObstacles;
+
+    batch->lasers[index] = world->lasers;
+    batch->shooters[index] = world->shooters;
+    batch->fireballs[index] = world->fireballs;
+    memcpy(batch->fireballSlots + index * SIM_FIREBALL_WORDS, world->fireballSlots, sizeof(world->fireballSlots));
+    batch->fireballCapacity[index] = world->fireballCapacity;
+    return true;
+}
+
+// Toplu motorun tuttuğu alanları world'e yazar; görsel alanlara dokunmaz
+void SimBatchStoreWorld(const SimBatch *batch, int index, GameWorld *world) {
+    uint8_t flags = batch->flags[index];
+
+    world->corePosition = (Vector2){ batch->coreX[index], batch->coreY[index] };
+    world->velocity = (Vector2){ batch->velocityX[index], batch->velocityY[index] };
+    world->targetPosition = (Vector2){ batch->targetX[index], batch->targetY[index] };
+    world->timeScale = batch->timeScale[index];
+    world->levelTime = batch->levelTime[index];
+    world->completionTime = batch->completionTime[index];
+    world->tick = batch->tick[index];
+    world->laserPhase = batch->laserPhase[index];
+    world->level = batch->level[index];
+    world->aiming = (flags & BATCH_FLAG_AIMING) != 0;
+    world->bulletTimeActive = (flags & BATCH_FLAG_BULLET_TIME) != 0;
+    world->gameOver = (flags & BATCH_FLAG_GAME_OVER) != 0;
+    world->victory = (flags & BATCH_FLAG_VICTORY) != 0;
+
+    int firstObstacle = index * NUM_OBSTACLES;
+    memcpy(world->obstacles, batch->obstacles + firstObstacle, sizeof(world->obstacles));
+    memcpy(world->obstacleOrder, batch->obstacleOrder + firstObstacle, sizeof(world->obstacleOrder));
+    world->aliveObstacles = batch->aliveObstacles[index];
+    world->explodingObstacles = batch->explodingObstacles[index];
+
+    world->lasers = batch->lasers[index];
+    world->shooters = batch->shooters[index];
+    world->fireballs = batch->fireballs[index];
+    memcpy(world->fireballSlots, batch->fireballSlots + index * SIM_FIREBALL_WORDS, sizeof(world->fireballSlots));
+    world->fireballCapacity = batch->fireballCapacity[index];
+}
+
+bool SimBatchResetWorld(SimBatch *batch, int index, int level) {
+    if (level < 0 || level >= MAX_LEVELS) return false;
+    return SimBatchLoadWorld(batch, index, &batch->levelStarts[level]);
+}
+
+int SimBatchActiveCount(const SimBatch *batch) {
+    int active = 0;
+    for (int w = 0; w < batch->count; w++) {
+        if (!(batch->flags[w] & BATCH_FLAG_DONE)) active++;
+    }
+    return active;
+}
+
+// === Toplu adım ===
+// Dünyanın skalerleri sütunlardan ortak gövdenin durumuna yüklenir ve geri yazılır
+static inline void BatchLoadTickState(const SimBatch *batch, int w, SimTickState *state) {
+    uint8_t flags = batch->flags[w];
+
+    *state = (SimTickState){
+        .tick = batch->tick[w],
+        .levelTime = batch->levelTime[w],
+        .completionTime = batch->completionTime[w],
+        .corePosition = { batch->coreX[w], batch->coreY[w] },
+        .velocity = { batch->velocityX[w], batch->velocityY[w] },
+        .targetPosition = { batch->targetX[w], batch->targetY[w] },
+        .timeScale = batch->timeScale[w],
+        .aiming = (flags & BATCH_FLAG_AIMING) != 0,
+        .bulletTimeActive = (flags & BATCH_FLAG_BULLET_TIME) != 0,
+        .gameOver = (flags & BATCH_FLAG_GAME_OVER) != 0,
+        .victory = (flags & BATCH_FLAG_VICTORY) != 0,
+        .laserPhase = batch->laserPhase[w],
+        .obstacles = batch->obstacles + w * NUM_OBSTACLES,
+        .obstacleOrder = batch->obstacleOrder + w * NUM_OBSTACLES,
+        .aliveObstacles = batch->aliveObstacles[w],
+        .explodingObstacles = batch->explodingObstacles[w],
+        .lasers = &batch->lasers[w],
+        .shooters = &batch->shooters[w],
+        .fireballs = &batch->fireballs[w],
+        .fireballSlots = batch->fireballSlots + w * SIM_FIREBALL_WORDS,
+        .fireballCapacity = batch->fireballCapacity[w]
+    };
+}
+
+static inline void BatchStoreTickState(SimBatch *batch, int w, const SimTickState *state) {
+    batch->tick[w] = state->tick;
+    batch->levelTime[w] = state->levelTime;
+    batch->completionTime[w] = state->completionTime;
+    batch->coreX[w] = state->corePosition.x;
+    batch->coreY[w] = state->corePosition.y;
+    batch->velocityX[w] = state->velocity.x;
+    batch->velocityY[w] = state->velocity.y;
+    batch->targetX[w] = state->targetPosition.x;
+    batch->targetY[w] = state->targetPosition.y;
+    batch->timeScale[w] = state->timeScale;
+    batch->laserPhase[w] = state->laserPhase;
+    batch->aliveObstacles[w] = state->aliveObstacles;
+    batch->explodingObstacles[w] = state->explodingObstacles;
+    batch->flags[w] = (state->aiming ? BATCH_FLAG_AIMING : 0) |
+                      (state->bulletTimeActive ? BATCH_FLAG_BULLET_TIME : 0) |
+                      (state->gameOver ? BATCH_FLAG_GAME_OVER : 0) |
+                      (state->victory ? BATCH_FLAG_VICTORY : 0);
+}
+
+// Tek bir dünyayı bir tick ilerletir; gövde SimStep'inkidir (flaming_rules.h)
+static inline void BatchStepWorld(SimBatch *batch, int w, const SimInput *input, float dt) {
+    static const SimInput noInput = { 0 };
+    if (input == NULL) input = &noInput;
+
+    SimTickState state;
+    BatchLoadTickState(batch, w, &state);
+
+    if (SimTickBegin(&state, input, dt)) {
+        // Level 3'ten önceki levellerin duvar tablosu boştur
+        int level = batch->level[w];
+        SimTickLevel tickLevel = {
+            &batch->grids[level], (batch->wallSegments[level].count > 0) ? &batch->wallSegments[level] : NULL,
+            batch->sdf[level], batch->fireballKernel, batch->segmentKernel,
+            batch->coreRadius, batch->screenWidth, batch->screenHeight
+        };
+        SimTickResult result;
+        SimTickRun(&state, &tickLevel, input, dt, &result);
+    }
+
+    BatchStoreTickState(batch, w, &state);
+}
+
+void SimStepBatchWorld(SimBatch *batch, int index, const SimInput *input, float dt) {
+    if (batch->flags[index] & BATCH_FLAG_DONE) return;
+    BatchStepWorld(batch, index, input, dt);
+}
+
+void SimStepBatch(SimBatch *batch, const SimInput *inputs, float dt) {
+    for (int w = 0; w < batch->count; w++) {
+        if (batch->flags[w] & BATCH_FLAG_DONE) continue;
+        BatchStepWorld(batch, w, inputs != NULL ? &inputs[w] : NULL, dt);
+    }
+}
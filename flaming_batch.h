@@ -0,0 +1,89 @@
+#ifndef FLAMING_BATCH_H
+#define FLAMING_BATCH_H
+
+// Çok sayıda bağımsız dünyayı tek çağrıda ilerleten toplu simülasyon motoru.
+// Dünyaların skaler alanları dizilerin yapısı (SoA) düzeninde tutulur: her alan
+// için tüm dünyaları kapsayan ayrı bir dizi vardır. Engeller ve türlerin
+// kümeleri (LaserSet, ShooterSet, FireballSet) GameWorld'dekilerle aynı
+// yapılardır, dünya başına birer tane. Tick SimStep'inkiyle aynı gövdedir
+// (flaming_rules.h, SimTickRun), bu yüzden SimStepBatch her dünya için SimStep
+// ile aynı oyun sonucunu üretir.
+//
+// Yalnızca oyunun sonucunu etkileyen durum tutulur; trail ve patlama
+// parçacıkları gibi görsel veriler toplu motorda yoktur. Oyun biten dünyalar
+// (victory ya da gameOver) sonraki çağrılarda atlanır.
+
+#include "flaming_sim.h"
+#include "flaming_sdf.h"
+#include "flaming_simd.h"
+#include <stdint.h>
+
+// Dünya durum bayrakları
+#define BATCH_FLAG_AIMING       0x01
+#define BATCH_FLAG_BULLET_TIME  0x02
+#define BATCH_FLAG_GAME_OVER    0x04
+#define BATCH_FLAG_VICTORY      0x08
+#define BATCH_FLAG_DONE         (BATCH_FLAG_GAME_OVER | BATCH_FLAG_VICTORY)
+
+typedef struct {
+    int count;  // Dünya sayısı
+    float screenWidth;
+    float screenHeight;
+    float coreRadius;  // Duvar tabloları ve ızgaralar buna göre kurulur (CORE_RADIUS)
+
+    // Dünya başına (count)
+    float *coreX;
+    float *coreY;
+    float *velocityX;
+    float *velocityY;
+    float *targetX;
+    float *targetY;
+    float *timeScale;
+    float *levelTime;
+    float *completionTime;
+    int *tick;
+    uint32_t *laserPhase;
+    int *aliveObstacles;      // GameWorld::aliveObstacles
+    int *explodingObstacles;  // GameWorld::explodingObstacles
+    uint64_t *fireballSlots;  // Dünya başına SIM_FIREBALL_WORDS kelime (GameWorld::fireballSlots)
+    int *fireballCapacity;
+    uint8_t *level;
+    uint8_t *flags;
+
+    // Engeller dünya başına NUM_OBSTACLES (count * NUM_OBSTACLES); obstacleOrder
+    // GameWorld'deki gibi duruma göre sıkışık (yaşayan, patlayan, ölü)
+    Obstacle *obstacles;
+    uint16_t *obstacleOrder;
+
+    // Türlerin kümeleri dünya başına bir tane (count); GameWorld'deki yerleriyle
+    LaserSet *lasers;
+    ShooterSet *shooters;
+    FireballSet *fireballs;
+
+    // Level başına başlangıç durumu (SimBatchResetWorld), statik duvarlar ve
+    // engel/duvar ızgarası; ızgaradaki duvar indeksleri wallSegments'e göre
+    GameWorld *levelStarts;  // MAX_LEVELS dünya, seed 0
+    SimSegmentTable wallSegments[MAX_LEVELS];
+    SimGrid grids[MAX_LEVELS];
+    const SimSdf *sdf[MAX_LEVELS];  // Duvarların uzaklık alanı (flaming_sdf.h); duvarsız levellerde NULL
+
+    SimSimdLevel simdLevel;  // SimBatchCreate işlemciye göre seçer
+    SimFireballKernelFn fireballKernel;
+    SimSegmentKernelFn segmentKernel;
+} SimBatch;
+
+// === Fonksiyon prototipleri ===
+bool SimBatchCreate(SimBatch *batch, int count, float screenWidth, float screenHeight);
+void SimBatchDestroy(SimBatch *batch);
+// Engeller level kurulumundaki yerlerinde olmalı. Ekran boyutu ve topun yarıçapı
+// batch'inkinden farklı ya da level geçersizse dünya yüklenmez, false döner.
+bool SimBatchLoadWorld(SimBatch *batch, int index, const GameWorld *world);
+void SimBatchStoreWorld(const SimBatch *batch, int index, GameWorld *world);
+// Dünyayı levelin başına döndürür; SimInitWorld ve SimBatchLoadWorld ile aynı
+// sonuç (seed yalnızca toplu motorda olmayan parçacıkları etkiler)
+bool SimBatchResetWorld(SimBatch *batch, int index, int level);
+void SimStepBatchWorld(SimBatch *batch, int index, const SimInput *input, float dt);  // Tek dünya; bitmişse atlanır
+void SimStepBatch(SimBatch *batch, const SimInput *inputs, float dt);  // inputs: count adet ya da NULL
+int SimBatchActiveCount(const SimBatch *batch);
+
+#endif // FLAMING_BATCH_H
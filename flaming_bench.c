@@ -0,0 +1,660 @@
+// Flaming Core simülasyon benchmark'ı
+// Her level'i SetupLevel(0..4) ile yükler, sabit bir girdi senaryosuyla
+// ekransız oynatır ve tick başına süreyi ölçer. Linux'ta donanım sayaçları
+// (cache miss, branch miss) perf_event_open ile okunur; izin yoksa atlanır.
+// Toplu motorun vektör düzeyi FLAMING_SIMD ile sınırlanabilir (flaming_simd.h).
+// "advance" aynı senaryoyu SimAdvance (flaming_event.h) ile, girdinin
+// değişmediği tick'leri tek çağrıda ilerleterek oynatır. Sonda ateş topu ve
+// parçacık güncellemesi --entities kadar varlıkta AoS ve SoA düzenleriyle ölçülür.
+//
+// Derleme: gcc -O2 flaming_bench.c flaming_sim.c flaming_event.c flaming_ccd.c flaming_grid.c flaming_batch.c flaming_simd.c flaming_sdf.c -o flaming_bench -lm -lpthread
+// Kullanım: ./flaming_bench [--ticks N] [--repeat N] [--entities N] [--json dosya] [--label metin]
+
+#include "flaming_sim.h"
+#include "flaming_batch.h"
+#include "flaming_event.h"
+#include "flaming_rules.h"
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#define BENCH_SCREEN_WIDTH 1470
+#define BENCH_SCREEN_HEIGHT 818
+#define BENCH_DEFAULT_TICKS 1000000
+#define BENCH_DEFAULT_REPEAT 3
+#define BENCH_BATCH_WORLDS 256
+#define BENCH_SEED 12345u
+#define BENCH_DEFAULT_ENTITIES 16384
+#define BENCH_LAYOUT_PASSES 64
+
+// === Donanım sayaçları ===
+typedef enum {
+    COUNTER_INSTRUCTIONS,
+    COUNTER_CACHE_MISSES,
+    COUNTER_BRANCHES,
+    COUNTER_BRANCH_MISSES,
+    COUNTER_COUNT
+} CounterId;
+
+static const char *counterNames[COUNTER_COUNT] = {
+    "instructions", "cache_misses", "branches", "branch_misses"
+};
+
+typedef struct {
+    int fd[COUNTER_COUNT];  // -1: sayaç yok
+    uint64_t value[COUNTER_COUNT];
+} Counters;
+
+static void OpenCounters(Counters *counters) {
+    for (int i = 0; i < COUNTER_COUNT; i++) counters->fd[i] = -1;
+
+#ifdef __linux__
+    static const uint64_t configs[COUNTER_COUNT] = {
+        PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES,
+        PERF_COUNT_HW_BRANCH_INSTRUCTIONS, PERF_COUNT_HW_BRANCH_MISSES
+    };
+
+    for (int i = 0; i < COUNTER_COUNT; i++) {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = configs[i];
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        counters->fd[i] = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    }
+#endif
+}
+
+static void CloseCounters(Counters *counters) {
+#ifdef __linux__
+    for (int i = 0; i < COUNTER_COUNT; i++) {
+        if (counters->fd[i] >= 0) close(counters->fd[i]);
+    }
+#endif
+    (void)counters;
+}
+
+static void StartCounters(Counters *counters) {
+#ifdef __linux__
+    for (int i = 0; i < COUNTER_COUNT; i++) {
+        if (counters->fd[i] < 0) continue;
+        ioctl(counters->fd[i], PERF_EVENT_IOC_RESET, 0);
+        ioctl(counters->fd[i], PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+    (void)counters;
+}
+
+static void StopCounters(Counters *counters) {
+    for (int i = 0; i < COUNTER_COUNT; i++) {
+        counters->value[i] = 0;
+#ifdef __linux__
+        if (counters->fd[i] < 0) continue;
+        ioctl(counters->fd[i], PERF_EVENT_IOC_DISABLE, 0);
+        if (read(counters->fd[i], &counters->value[i], sizeof(uint64_t)) != sizeof(uint64_t)) {
+            counters->value[i] = 0;
+        }
+#endif
+    }
+}
+
+static double BenchSeconds(void) {
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    return (double)now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+// === Girdi senaryosu ===
+// Her 1.5 saniyede ekrandaki sabit bir noktaya nişan alınıp bırakılır, arada
+// bir bullet-time açılıp kapanır. Noktalar tick sayısından türetildiği için
+// senaryo her çalıştırmada ve her commit'te aynıdır.
+static void ScriptedInput(int tick, SimInput *input) {
+    static const Vector2 targets[] = {
+        { 200, 150 }, { 1270, 650 }, { 735, 100 }, { 300, 700 },
+        { 1200, 200 }, { 735, 409 }, { 100, 409 }, { 1370, 409 }
+    };
+    int period = SIM_TICK_RATE * 3 / 2;
+    int phase = tick % period;
+
+    *input = (SimInput){ 0 };
+
+    if (phase == 0) {
+        input->aimDown = true;
+        input->aimTarget = targets[(tick / period) % (int)(sizeof(targets) / sizeof(targets[0]))];
+    }
+    else if (phase == 1) {
+        input->aimReleased = true;
+    }
+    else if (phase == period / 2 || phase == period / 2 + SIM_TICK_RATE / 4) {
+        input->toggleBulletTime = true;
+    }
+}
+
+// tick'teki girdi kaç tick boyunca aynı kalır
+static int ScriptedQuietTicks(int tick) {
+    int period = SIM_TICK_RATE * 3 / 2;
+    int toggle = period / 2 + SIM_TICK_RATE / 4;
+    int changes[] = { 1, 2, period / 2, period / 2 + 1, toggle, toggle + 1, period };
+    int phase = tick % period;
+
+    for (int i = 0; i < (int)(sizeof(changes) / sizeof(changes[0])); i++) {
+        if (phase < changes[i]) return changes[i] - phase;
+    }
+    return 1;
+}
+
+// === Ölçümler ===
+typedef struct {
+    const char *engine;
+    int level;
+    long long ticks;
+    double seconds;
+    uint64_t counters[COUNTER_COUNT];
+    bool hasCounters[COUNTER_COUNT];
+} BenchResult;
+
+// Biten koşu level başının kopyasından yeni tohumla yeniden başlar; SimInitWorld
+// ile aynı dünyadır (tohum yalnızca rng'yi belirler). Toplu motordaki
+// SimBatchResetWorld gibi ızgara ve duvar tabloları her koşuda yeniden kurulmaz.
+static void BenchRestart(GameWorld *world, const GameWorld *levelStart, uint64_t seed) {
+    *world = *levelStart;
+    world->seed = seed;
+    SimRngSeed(&world->rng, seed, SIM_RNG_STREAM_WORLD);
+}
+
+// Tek dünyayı SimStep ile ilerletir; koşu bitince level baştan başlar
+static void BenchSimStep(int level, long long ticks, Counters *counters, BenchResult *result) {
+    GameWorld *world = malloc(2 * sizeof(GameWorld));
+    SimInput input;
+    uint64_t run = 0;
+
+    if (world == NULL) {
+        result->ticks = 0;
+        return;
+    }
+
+    GameWorld *levelStart = world + 1;
+    SimInitWorld(levelStart, level, BENCH_SCREEN_WIDTH, BENCH_SCREEN_HEIGHT, BENCH_SEED);
+    BenchRestart(world, levelStart, BENCH_SEED);
+
+    StartCounters(counters);
+    double start = BenchSeconds();
+
+    for (long long tick = 0; tick < ticks; tick++) {
+        ScriptedInput(world->tick, &input);
+        unsigned int events = SimStep(world, &input, SIM_DT);
+
+        // Toplu motor gibi sonuç belli olunca yeniden başla (patlama animasyonu ölçülmez)
+        if (events & (SIM_EVENT_CORE_DESTROYED | SIM_EVENT_LEVEL_COMPLETED)) {
+            BenchRestart(world, levelStart, BENCH_SEED + ++run);
+        }
+    }
+
+    result->seconds = BenchSeconds() - start;
+    StopCounters(counters);
+
+    result->ticks = ticks;
+    free(world);
+}
+
+// Aynı senaryo SimAdvance ile; tick sayısı simüle edilen tick'lerdir
+static void BenchAdvance(int level, long long ticks, Counters *counters, BenchResult *result) {
+    GameWorld *world = malloc(2 * sizeof(GameWorld));
+    SimInput input;
+    uint64_t run = 0;
+    long long tick = 0;
+
+    if (world == NULL) {
+        result->ticks = 0;
+        return;
+    }
+
+    GameWorld *levelStart = world + 1;
+    SimInitWorld(levelStart, level, BENCH_SCREEN_WIDTH, BENCH_SCREEN_HEIGHT, BENCH_SEED);
+    BenchRestart(world, levelStart, BENCH_SEED);
+
+    StartCounters(counters);
+    double start = BenchSeconds();
+
+    while (tick < ticks) {
+        ScriptedInput(world->tick, &input);
+        int count = ScriptedQuietTicks(world->tick);
+        if (count > ticks - tick) count = (int)(ticks - tick);
+
+        unsigned int events;
+        tick += SimAdvance(world, &input, SIM_DT, count, &events);
+
+        if (events & (SIM_EVENT_CORE_DESTROYED | SIM_EVENT_LEVEL_COMPLETED)) {
+            BenchRestart(world, levelStart, BENCH_SEED + ++run);
+        }
+    }
+
+    result->seconds = BenchSeconds() - start;
+    StopCounters(counters);
+
+    result->ticks = ticks;
+    free(world);
+}
+
+// BENCH_BATCH_WORLDS dünyayı SimStepBatch ile ilerletir; biten dünyalar levelin başına döner
+static void BenchBatch(int level, long long ticks, Counters *counters, BenchResult *result) {
+    SimBatch batch;
+    SimInput inputs[BENCH_BATCH_WORLDS];
+    long long worldTicks = 0;
+
+    if (!SimBatchCreate(&batch, BENCH_BATCH_WORLDS, BENCH_SCREEN_WIDTH, BENCH_SCREEN_HEIGHT)) {
+        result->ticks = 0;
+        return;
+    }
+
+    // Başlangıç durumları batch'in ölçüleriyle kurulur; ilk sıfırlama geçerse sonrakiler de geçer
+    bool loaded = true;
+    for (int w = 0; w < BENCH_BATCH_WORLDS && loaded; w++) {
+        loaded = SimBatchResetWorld(&batch, w, level);
+    }
+    if (!loaded) {
+        SimBatchDestroy(&batch);
+        result->ticks = 0;
+        return;
+    }
+
+    StartCounters(counters);
+    double start = BenchSeconds();
+
+    while (worldTicks < ticks) {
+        for (int w = 0; w < BENCH_BATCH_WORLDS; w++) {
+            if (batch.flags[w] & BATCH_FLAG_DONE) SimBatchResetWorld(&batch, w, level);
+            ScriptedInput(batch.tick[w], &inputs[w]);
+        }
+
+        SimStepBatch(&batch, inputs, SIM_DT);
+        worldTicks += BENCH_BATCH_WORLDS;
+    }
+
+    result->seconds = BenchSeconds() - start;
+    StopCounters(counters);
+
+    result->ticks = worldTicks;
+    SimBatchDestroy(&batch);
+}
+
+// Aynı ölçümü birkaç kez yapar ve en hızlısını tutar
+static void RunBench(const char *engine, int level, long long ticks, int repeat, Counters *counters,
+                     BenchResult *result) {
+    memset(result, 0, sizeof(*result));
+
+    for (int i = 0; i < repeat; i++) {
+        BenchResult attempt = { 0 };
+
+        if (strcmp(engine, "batch") == 0) BenchBatch(level, ticks, counters, &attempt);
+        else if (strcmp(engine, "advance") == 0) BenchAdvance(level, ticks, counters, &attempt);
+        else BenchSimStep(level, ticks, counters, &attempt);
+
+        for (int c = 0; c < COUNTER_COUNT; c++) {
+            attempt.counters[c] = counters->value[c];
+            attempt.hasCounters[c] = counters->fd[c] >= 0;
+        }
+
+        if (i == 0 || attempt.seconds * result->ticks < result->seconds * attempt.ticks) {
+            *result = attempt;
+        }
+    }
+
+    result->engine = engine;
+    result->level = level;
+}
+
+static double NsPerTick(const BenchResult *result) {
+    return result->ticks > 0 ? result->seconds * 1e9 / result->ticks : 0.0;
+}
+
+// === Bellek düzeni ===
+// Ateş topu ve patlama parçacığı güncellemesini aynı sayıda varlıkta iki düzende
+// çalıştırır: GameWorld'ün eski AoS yapıları (sıcak ve soğuk alanlar aynı önbellek
+// satırında) ve bugünkü SoA dizileri. Ateş topları toplu motordaki gibi
+// MAX_FIREBALLS'luk dilimlerle çekirdeğe verilir. SoA parçacıklar güncellenmez;
+// her geçişte konum ve alfa doğum anından hesaplanır (SimEvalParticles, çizimin
+// yaptığı iş). Varlıklar BENCH_LAYOUT_PASSES tick boyunca ekranda ve aktif kalır;
+// sonuç varlık-tick başına ns'dir.
+typedef struct {
+    Vector2 position;
+    Vector2 velocity;
+    float radius;
+    bool active;
+    float lifeTime;
+} AosFireball;
+
+typedef struct {
+    Vector2 position;
+    Vector2 velocity;
+    float radius;
+    float alpha;
+    unsigned char palette;
+    unsigned char shade;
+    bool active;
+} AosParticle;
+
+typedef struct {
+    AosFireball *aosFireballs;
+    AosParticle *aosParticles;
+
+    char *soa;  // Aşağıdaki dizilerin bloğu
+    float *x;
+    float *y;
+    float *velocityX;
+    float *velocityY;
+    float *lifeTime;  // Ateş topları; parçacıkların doğum anı da (hepsi 0)
+    float *lifetime;  // Parçacıklar
+    float *drawX;     // Parçacıkların hesaplanan konumu ve alfası
+    float *drawY;
+    float *alpha;
+    uint8_t *fireballActive;
+    int count;
+} LayoutData;
+
+typedef struct {
+    const char *kind;
+    const char *layout;
+    int entities;
+    double seconds;  // BENCH_LAYOUT_PASSES tick'in en hızlısı
+} LayoutResult;
+
+// SoA dizileri tek blokta, aralarında BENCH_LAYOUT_SKEW baytla durur. Aynı
+// boyda ayrı ayrı ayrılan diziler aynı 4 KB kaydırmasına düşer; i. elemanların
+// yazma ve okumaları işlemcide birbirini bekler (4K aliasing) ve ölçülen düzen
+// değil bu olur.
+#define BENCH_LAYOUT_SKEW 320
+
+static void *TakeLayoutArray(char **cursor, size_t bytes) {
+    void *array = *cursor;
+    *cursor += (bytes + BENCH_LAYOUT_SKEW + 63) / 64 * 64;
+    return array;
+}
+
+static bool CreateLayoutData(LayoutData *data, int count) {
+    // SimEvalParticles son bloğu tam okur; diziler blok katına uzatılıp sıfırlanır
+    size_t padded = (size_t)(count + SIM_PARTICLE_LANES - 1) / SIM_PARTICLE_LANES * SIM_PARTICLE_LANES;
+    size_t floats = padded * sizeof(float);
+    size_t bytes = padded;
+
+    data->count = count;
+    data->aosFireballs = malloc((size_t)count * sizeof(AosFireball));
+    data->aosParticles = malloc((size_t)count * sizeof(AosParticle));
+    data->soa = calloc(1, 9 * (floats + BENCH_LAYOUT_SKEW + 64) + bytes + BENCH_LAYOUT_SKEW + 64);
+    if (data->aosFireballs == NULL || data->aosParticles == NULL || data->soa == NULL) return false;
+
+    char *cursor = data->soa;
+    data->x = TakeLayoutArray(&cursor, floats);
+    data->y = TakeLayoutArray(&cursor, floats);
+    data->velocityX = TakeLayoutArray(&cursor, floats);
+    data->velocityY = TakeLayoutArray(&cursor, floats);
+    data->lifeTime = TakeLayoutArray(&cursor, floats);
+    data->lifetime = TakeLayoutArray(&cursor, floats);
+    data->drawX = TakeLayoutArray(&cursor, floats);
+    data->drawY = TakeLayoutArray(&cursor, floats);
+    data->alpha = TakeLayoutArray(&cursor, floats);
+    data->fireballActive = TakeLayoutArray(&cursor, bytes);
+    return true;
+}
+
+static void DestroyLayoutData(LayoutData *data) {
+    free(data->aosFireballs);
+    free(data->aosParticles);
+    free(data->soa);
+}
+
+// Her iki düzene aynı varlıkları yazar; ölçüm boyunca hiçbiri ekrandan çıkmaz
+static void FillLayoutData(LayoutData *data) {
+    SimRng rng;
+    SimRngSeed(&rng, BENCH_SEED, SIM_RNG_STREAM_WORLD);
+
+    for (int i = 0; i < data->count; i++) {
+        Vector2 position = { (float)SimRngRange(&rng, 200, BENCH_SCREEN_WIDTH - 200),
+                             (float)SimRngRange(&rng, 200, BENCH_SCREEN_HEIGHT - 200) };
+        float angle = SimRngRange(&rng, 0, 360) * SIM_DEG2RAD;
+        Vector2 velocity = { cosf(angle) * FIREBALL_SPEED, sinf(angle) * FIREBALL_SPEED };
+
+        data->aosFireballs[i] = (AosFireball){ position, velocity, FIREBALL_RADIUS, true, 0.0f };
+        data->aosParticles[i] = (AosParticle){ position, velocity, 4.0f, 1.0f, PALETTE_LASER, 0, true };
+
+        data->x[i] = position.x;
+        data->y[i] = position.y;
+        data->velocityX[i] = velocity.x;
+        data->velocityY[i] = velocity.y;
+        data->lifeTime[i] = 0.0f;
+        data->lifetime[i] = simEmitters[EMITTER_CORE].lifetime;
+        data->fireballActive[i] = 1;
+    }
+}
+
+// Eski UpdateFireballs döngüsü
+static void AosFireballTick(AosFireball *fireballs, int count, float deltaTime, Vector2 core) {
+    for (int i = 0; i < count; i++) {
+        AosFireball *fireball = &fireballs[i];
+        if (!fireball->active) continue;
+
+        Vector2 from = fireball->position;
+        fireball->position.x += fireball->velocity.x * deltaTime;
+        fireball->position.y += fireball->velocity.y * deltaTime;
+        fireball->lifeTime += deltaTime;
+
+        if (SimFireballExpired(fireball->position, fireball->lifeTime, BENCH_SCREEN_WIDTH, BENCH_SCREEN_HEIGHT)) {
+            fireball->active = false;
+            continue;
+        }
+        if (SimSweptCircleHit(from, fireball->position, core, fireball->radius + CORE_RADIUS)) {
+            fireball->active = false;
+        }
+    }
+}
+
+// Eski patlama döngüsü; beyaz topun parçacık ömründe ölçüm boyunca hiçbiri sönmez
+static void AosParticleTick(AosParticle *particles, int count, float dt) {
+    for (int i = 0; i < count; i++) {
+        AosParticle *particle = &particles[i];
+        if (!particle->active) continue;
+
+        particle->position.x += particle->velocity.x * dt;
+        particle->position.y += particle->velocity.y * dt;
+
+        particle->alpha -= dt / simEmitters[EMITTER_CORE].lifetime;
+        if (particle->alpha < 0) {
+            particle->alpha = 0;
+            particle->active = false;
+        }
+    }
+}
+
+static void SoaFireballTick(const LayoutData *data, SimFireballKernelFn kernel, float deltaTime, Vector2 core) {
+    SimFireballParams params = {
+        deltaTime, core, FIREBALL_RADIUS, CORE_RADIUS, BENCH_SCREEN_WIDTH, BENCH_SCREEN_HEIGHT
+    };
+
+    for (int first = 0; first < data->count; first += MAX_FIREBALLS) {
+        int count = (data->count - first < MAX_FIREBALLS) ? data->count - first : MAX_FIREBALLS;
+        uint64_t slots[SIM_FIREBALL_WORDS];  // Varlıklar kapanmaz; harita yalnızca çekirdeğe verilir
+        memset(slots, 0xff, sizeof(slots));
+        SimFireballSpan span = {
+            data->x + first, data->y + first, data->velocityX + first, data->velocityY + first,
+            data->lifeTime + first, data->fireballActive + first, slots, count
+        };
+        int hitIndex;
+        kernel(&span, &params, &hitIndex);
+    }
+}
+
+// layout: "aos", "soa" (skaler çekirdek) ya da "soa-simd" (seçilen vektör düzeyi)
+static double LayoutTicks(LayoutData *data, const char *kind, const char *layout) {
+    SimFireballKernelFn kernel = SimFireballKernel(strcmp(layout, "soa-simd") == 0 ? SimSimdDetect() : SIM_SIMD_SCALAR);
+    SimParticleSpan particles = {
+        data->x, data->y, data->velocityX, data->velocityY, data->lifeTime, data->lifetime, data->count
+    };
+    Vector2 core = { -1000.0f, -1000.0f };  // Beyaz top yanmış; çarpışma testi yine yapılır
+    bool aos = strcmp(layout, "aos") == 0;
+    bool fireballs = strcmp(kind, "fireball") == 0;
+
+    FillLayoutData(data);
+    double start = BenchSeconds();
+
+    for (int pass = 0; pass < BENCH_LAYOUT_PASSES; pass++) {
+        if (fireballs && aos) AosFireballTick(data->aosFireballs, data->count, SIM_DT, core);
+        else if (fireballs) SoaFireballTick(data, kernel, SIM_DT, core);
+        else if (aos) AosParticleTick(data->aosParticles, data->count, SIM_DT);
+        else SimEvalParticles(&particles, (pass + 1) * SIM_DT, data->drawX, data->drawY, data->alpha);
+    }
+
+    return BenchSeconds() - start;
+}
+
+static void RunLayoutBench(LayoutData *data, const char *kind, const char *layout, int repeat,
+                           LayoutResult *result) {
+    result->kind = kind;
+    result->layout = layout;
+    result->entities = data->count;
+
+    for (int i = 0; i < repeat; i++) {
+        double seconds = LayoutTicks(data, kind, layout);
+        if (i == 0 || seconds < result->seconds) result->seconds = seconds;
+    }
+}
+
+static double NsPerEntity(const LayoutResult *result) {
+    return result->seconds * 1e9 / ((double)result->entities * BENCH_LAYOUT_PASSES);
+}
+
+static void WriteJson(FILE *file, const char *label, long long ticks, const BenchResult *results, int count,
+                      const LayoutResult *layouts, int layoutCount) {
+    fprintf(file, "{\n");
+    fprintf(file, "  \"label\": \"%s\",\n", label != NULL ? label : "");
+    fprintf(file, "  \"tick_rate\": %d,\n", SIM_TICK_RATE);
+    fprintf(file, "  \"ticks\": %lld,\n", ticks);
+    fprintf(file, "  \"simd\": \"%s\",\n", SimSimdName(SimSimdDetect()));
+    fprintf(file, "  \"results\": [\n");
+
+    for (int i = 0; i < count; i++) {
+        const BenchResult *result = &results[i];
+        fprintf(file, "    { \"engine\": \"%s\", \"level\": %d, \"ticks\": %lld, \"seconds\": %.6f, "
+                      "\"ns_per_tick\": %.2f, \"ticks_per_sec\": %.0f",
+                result->engine, result->level + 1, result->ticks, result->seconds,
+                NsPerTick(result), result->seconds > 0 ? result->ticks / result->seconds : 0.0);
+
+        for (int c = 0; c < COUNTER_COUNT; c++) {
+            if (result->hasCounters[c]) fprintf(file, ", \"%s\": %" PRIu64, counterNames[c], result->counters[c]);
+            else fprintf(file, ", \"%s\": null", counterNames[c]);
+        }
+
+        fprintf(file, " }%s\n", (i + 1 < count) ? "," : "");
+    }
+
+    fprintf(file, "  ],\n");
+    fprintf(file, "  \"layout\": [\n");
+
+    for (int i = 0; i < layoutCount; i++) {
+        const LayoutResult *layout = &layouts[i];
+        fprintf(file, "    { \"kind\": \"%s\", \"layout\": \"%s\", \"entities\": %d, \"ns_per_entity\": %.3f }%s\n",
+                layout->kind, layout->layout, layout->entities, NsPerEntity(layout), (i + 1 < layoutCount) ? "," : "");
+    }
+
+    fprintf(file, "  ]\n}\n");
+}
+
+int main(int argc, char **argv) {
+    long long ticks = BENCH_DEFAULT_TICKS;
+    int repeat = BENCH_DEFAULT_REPEAT;
+    int entities = BENCH_DEFAULT_ENTITIES;
+    const char *jsonFileName = NULL;
+    const char *label = NULL;
+
+    // Bilinmeyen ya da değeri eksik bir seçenek yanlış yapılandırmayı sessizce
+    // ölçmesin diye kullanım mesajıyla reddedilir
+    bool valid = true;
+    for (int i = 1; i < argc && valid; i += 2) {
+        if (i + 1 >= argc) valid = false;
+        else if (strcmp(argv[i], "--ticks") == 0) ticks = atoll(argv[i + 1]);
+        else if (strcmp(argv[i], "--repeat") == 0) repeat = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "--entities") == 0) entities = atoi(argv[i + 1]);
+        else if (strcmp(argv[i], "--json") == 0) jsonFileName = argv[i + 1];
+        else if (strcmp(argv[i], "--label") == 0) label = argv[i + 1];
+        else valid = false;
+    }
+
+    if (!valid || ticks <= 0 || repeat <= 0 || entities <= 0) {
+        fprintf(stderr, "Kullanım: %s [--ticks N] [--repeat N] [--entities N] [--json dosya] [--label metin]\n",
+                argv[0]);
+        return 1;
+    }
+
+    static const char *engines[] = { "simstep", "batch", "advance" };
+    int engineCount = (int)(sizeof(engines) / sizeof(engines[0]));
+    BenchResult results[3 * MAX_LEVELS];
+    int count = 0;
+    Counters counters;
+
+    OpenCounters(&counters);
+    if (counters.fd[COUNTER_INSTRUCTIONS] < 0) printf("(donanım sayaçları kullanılamıyor)\n");
+    printf("simd: %s\n", SimSimdName(SimSimdDetect()));
+
+    printf("%-8s %5s %12s %10s %14s %12s %12s\n",
+           "engine", "level", "ticks", "ns/tick", "ticks/s", "cache-miss", "branch-miss");
+
+    for (int e = 0; e < engineCount; e++) {
+        for (int level = 0; level < MAX_LEVELS; level++) {
+            BenchResult *result = &results[count++];
+            RunBench(engines[e], level, ticks, repeat, &counters, result);
+
+            printf("%-8s %5d %12lld %10.1f %14.0f %12" PRIu64 " %12" PRIu64 "\n",
+                   result->engine, level + 1, result->ticks, NsPerTick(result),
+                   result->seconds > 0 ? result->ticks / result->seconds : 0.0,
+                   result->counters[COUNTER_CACHE_MISSES], result->counters[COUNTER_BRANCH_MISSES]);
+        }
+    }
+
+    CloseCounters(&counters);
+
+    static const char *layoutRuns[][2] = {
+        { "fireball", "aos" }, { "fireball", "soa" }, { "fireball", "soa-simd" },
+        { "particle", "aos" }, { "particle", "soa" }
+    };
+    int layoutCount = (int)(sizeof(layoutRuns) / sizeof(layoutRuns[0]));
+    LayoutResult layouts[sizeof(layoutRuns) / sizeof(layoutRuns[0])];
+    LayoutData data;
+
+    if (!CreateLayoutData(&data, entities)) {
+        fprintf(stderr, "Bellek yetersiz: %d varlık\n", entities);
+        DestroyLayoutData(&data);
+        return 1;
+    }
+
+    printf("\n%-10s %-9s %10s %12s\n", "kind", "layout", "entities", "ns/entity");
+    for (int i = 0; i < layoutCount; i++) {
+        RunLayoutBench(&data, layoutRuns[i][0], layoutRuns[i][1], repeat, &layouts[i]);
+        printf("%-10s %-9s %10d %12.3f\n", layouts[i].kind, layouts[i].layout, layouts[i].entities,
+               NsPerEntity(&layouts[i]));
+    }
+    DestroyLayoutData(&data);
+
+    if (jsonFileName != NULL) {
+        FILE *file = (strcmp(jsonFileName, "-") == 0) ? stdout : fopen(jsonFileName, "w");
+        if (file == NULL) {
+            fprintf(stderr, "JSON dosyası açılamadı: %s\n", jsonFileName);
+            return 1;
+        }
+        WriteJson(file, label, ticks, results, count, layouts, layoutCount);
+        if (file != stdout) fclose(file);
+    }
+
+    return 0;
+}
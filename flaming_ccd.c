@@ -0,0 +1,233 @@
+#include "flaming_ccd.h"
+#include "flaming_rules.h"
+#include <math.h>
+#include <stddef.h>
+
+// Temas anları tick'in kalan kısmının kesridir; 1'den büyükse bu tick olay yok
+#define CCD_NONE 2.0
+
+typedef enum {
+    CCD_EVENT_NONE,
+    CCD_EVENT_BOUNCE_X,
+    CCD_EVENT_BOUNCE_Y,
+    CCD_EVENT_OBSTACLE,
+    CCD_EVENT_BURN
+} CcdEvent;
+
+// Ekran kenarı: SimBounceOffScreen'deki koşulun ilk sağlandığı an
+static double EdgeTime(double position, double displacement, float velocity, double radius, double size) {
+    if (velocity < 0) {
+        double gap = position - radius;
+        if (gap <= 0.0) return 0.0;
+        return (gap <= -displacement) ? gap / -displacement : CCD_NONE;
+    }
+    if (velocity > 0) {
+        double gap = size - (position + radius);
+        if (gap <= 0.0) return 0.0;
+        return (gap <= displacement) ? gap / displacement : CCD_NONE;
+    }
+    return CCD_NONE;
+}
+
+// Merkez ile çember arasındaki uzaklığın radius'a ilk indiği an; travel = |s|
+static double CircleTime(double px, double py, double sx, double sy, double travel, Vector2 center, double radius) {
+    double dx = px - center.x;
+    double dy = py - center.y;
+    double distance = dx * dx + dy * dy;
+    if (distance <= radius * radius) return 0.0;
+    if (distance > (radius + travel) * (radius + travel)) return CCD_NONE;  // Erişilemez
+
+    double a = sx * sx + sy * sy;
+    double b = dx * sx + dy * sy;
+    if (a == 0.0 || b >= 0.0) return CCD_NONE;  // Uzaklaşıyor
+
+    double discriminant = b * b - a * (distance - radius * radius);
+    if (discriminant < 0.0) return CCD_NONE;
+    return (-b - sqrt(discriminant)) / a;
+}
+
+// u anında (kalan kısmın kesri) top, yönü direction olan lazere değiyor mu; kural SimPointNearLine
+static bool LaserTouches(Vector2 position, Vector2 direction, double u, double px, double py, double sx, double sy,
+                         int threshold) {
+    Vector2 point = { (float)(px + sx * u), (float)(py + sy * u) };
+    return SimPointNearLine(point, position, SimLaserEndFrom(position, direction), threshold);
+}
+
+// Bir süpürmede bütün lazerler aynı açıyla döner; örnek sayısı ve örnekler
+// arası dönüş yalnızca topun yoluna ve bu açıya bağlıdır. Süpürme başına bir
+// kez, ilk erişilebilir lazerde hesaplanır.
+typedef struct {
+    bool ready;
+    int samples;
+    Vector2 step;    // Örnekler arası dönüş
+    Vector2 offset;  // Tick başından süpürmenin başına dönüş; ilk süpürmede birim (tam)
+} LaserSweep;
+
+static void PrepareLaserSweep(const SimCcdScene *scene, LaserSweep *sweep, double elapsed, double travel) {
+    double turn = scene->laserTurn * (1.0 - elapsed);
+    double arc = fabs(turn) * SIM_DEG2RAD * LASER_LENGTH;
+    double spacing = (travel + arc) / SIM_CCD_LASER_STEP;
+
+    sweep->samples = (spacing < SIM_CCD_MAX_SAMPLES) ? (int)spacing + 1 : SIM_CCD_MAX_SAMPLES;
+    sweep->step = SimLaserDirection((float)(turn / sweep->samples));
+    sweep->offset = (elapsed > 0.0) ? SimLaserDirection((float)(scene->laserTurn * elapsed)) : (Vector2){ 1.0f, 0.0f };
+    sweep->ready = true;
+}
+
+// Dönen lazer: top ve lazer ucu örnekler arasında SIM_CCD_LASER_STEP'ten fazla
+// ilerlemez; ilk değen örnekle bir öncesi arası ikiye bölünerek daraltılır.
+// Lazerin yönü tick başındaki yönünden döndürmelerle bulunur: her örnekte
+// süpürmenin adımıyla, ikiye bölmede yarım açılı döndürmeyle; lazer başına
+// trigonometri yoktur.
+static double LaserTime(const SimCcdScene *scene, int k, LaserSweep *sweep, double elapsed, double px, double py,
+                        double sx, double sy, double travel, int threshold) {
+    // Top tick boyunca lazerin erişimine (SimLaserInReach) giremiyorsa atla
+    Vector2 center = scene->obstaclePosition[k];
+    double cx = center.x - px;
+    double cy = center.y - py;
+    double reach = LASER_LENGTH + 2.0 * threshold + 1.0 + travel;
+    if (cx * cx + cy * cy > reach * reach) return CCD_NONE;
+
+    if (!sweep->ready) PrepareLaserSweep(scene, sweep, elapsed, travel);
+    int samples = sweep->samples;
+    Vector2 step = sweep->step;
+    Vector2 direction = SimRotate(scene->laserDirection[k], sweep->offset);
+
+    double previous = 0.0;
+    for (int n = 1; n <= samples; n++) {
+        double u = (double)n / samples;
+        Vector2 next = SimRotate(direction, step);
+        if (!LaserTouches(center, next, u, px, py, sx, sy, threshold)) {
+            previous = u;
+            direction = next;
+            continue;
+        }
+
+        double low = previous;
+        double high = u;
+        Vector2 half = step;
+        for (int bisect = 0; bisect < SIM_CCD_BISECT_STEPS; bisect++) {
+            double middle = 0.5 * (low + high);
+            half = SimHalfRotation(half);
+            Vector2 between = SimRotate(direction, half);
+            if (LaserTouches(center, between, middle, px, py, sx, sy, threshold)) {
+                high = middle;
+            }
+            else {
+                low = middle;
+                direction = between;
+            }
+        }
+        return high;
+    }
+
+    return CCD_NONE;
+}
+
+void SimCcdResolve(const SimCcdScene *scene, Vector2 position, Vector2 velocity, float stepTime,
+                   SimCcdResult *result) {
+    double radius = scene->coreRadius;
+    int threshold = SimLaserThreshold(scene->coreRadius);
+    double elapsed = 0.0;
+
+    result->destroyed = false;
+    result->hitCount = 0;
+
+    // Erişilebilir aday ya da duvar yoksa ve kenara da varılmıyorsa süpürme
+    // atlanır. Döngünün ilk adımında remaining 1.0'dır; 1.0 ile çarpım değeri
+    // değiştirmediğinden sx, sy ve konum olaysız ilk adımla bit bit aynıdır.
+    if (scene->obstacleCount == 0 && scene->wallCount == 0) {
+        double sx = (double)velocity.x * stepTime;
+        double sy = (double)velocity.y * stepTime;
+        if (EdgeTime(position.x, sx, velocity.x, radius, scene->screenWidth) > 1.0 &&
+            EdgeTime(position.y, sy, velocity.y, radius, scene->screenHeight) > 1.0) {
+            result->position = (Vector2){ (float)(position.x + sx), (float)(position.y + sy) };
+            result->velocity = velocity;
+            return;
+        }
+    }
+
+    bool gone[NUM_OBSTACLES] = { false };
+    for (int event = 0; event <= SIM_CCD_MAX_EVENTS; event++) {
+        double remaining = 1.0 - elapsed;
+        double px = position.x;
+        double py = position.y;
+        double sx = (double)velocity.x * stepTime * remaining;
+        double sy = (double)velocity.y * stepTime * remaining;
+        double travel = sqrt(sx * sx + sy * sy);
+
+        // Olay sınırı aşıldı: kalan hareket olaysız tamamlanır
+        if (event == SIM_CCD_MAX_EVENTS) {
+            position = (Vector2){ (float)(px + sx), (float)(py + sy) };
+            break;
+        }
+
+        double first = CCD_NONE;
+        CcdEvent kind = CCD_EVENT_NONE;
+        int which = -1;
+
+        double u = EdgeTime(px, sx, velocity.x, radius, scene->screenWidth);
+        if (u < first) { first = u; kind = CCD_EVENT_BOUNCE_X; }
+        u = EdgeTime(py, sy, velocity.y, radius, scene->screenHeight);
+        if (u < first) { first = u; kind = CCD_EVENT_BOUNCE_Y; }
+
+        for (int k = 0; k < scene->obstacleCount; k++) {
+            if (gone[k]) continue;
+            u = CircleTime(px, py, sx, sy, travel, scene->obstaclePosition[k], radius + scene->obstacleRadius[k]);
+            if (u < first) { first = u; kind = CCD_EVENT_OBSTACLE; which = k; }
+        }
+
+        // Duvarlar float'la çözülür (vektör çekirdekleriyle aynı); yakma anı en fazla
+        // bir float yuvarlaması kadar erken ya da geç olabilir
+        if (scene->wallCount > 0) {
+            uint16_t all[MAX_DEADLY_WALLS];
+            const uint16_t *indices = scene->wallIndices;
+            if (indices == NULL) {
+                for (int w = 0; w < scene->wallCount; w++) all[w] = (uint16_t)w;
+                indices = all;
+            }
+
+            int hit;
+            Vector2 from = { position.x, position.y };
+            Vector2 displacement = { (float)sx, (float)sy };
+            float enter = (scene->wallKernel != NULL)
+                              ? scene->wallKernel(scene->walls, indices, scene->wallCount, from, displacement, &hit)
+                              : SimSegmentFirstEnter(scene->walls, indices, scene->wallCount, from, displacement, &hit);
+            if (hit >= 0 && enter < first) { first = enter; kind = CCD_EVENT_BURN; }
+        }
+
+        LaserSweep sweep = { 0 };
+        for (int k = 0; k < scene->laserCount; k++) {
+            if (gone[k]) continue;
+            u = LaserTime(scene, k, &sweep, elapsed, px, py, sx, sy, travel, threshold);
+            if (u < first) { first = u; kind = CCD_EVENT_BURN; }
+        }
+
+        if (first > 1.0) {
+            position = (Vector2){ (float)(px + sx), (float)(py + sy) };
+            break;
+        }
+
+        position = (Vector2){ (float)(px + sx * first), (float)(py + sy * first) };
+        elapsed += remaining * first;
+
+        if (kind == CCD_EVENT_BOUNCE_X) {
+            velocity.x = -velocity.x;
+        }
+        else if (kind == CCD_EVENT_BOUNCE_Y) {
+            velocity.y = -velocity.y;
+        }
+        else if (kind == CCD_EVENT_OBSTACLE) {
+            gone[which] = true;
+            result->hits[result->hitCount++] = scene->obstacleIndex[which];
+            velocity = SimReflectOffObstacle(position, scene->coreRadius, scene->obstaclePosition[which], velocity);
+        }
+        else {
+            result->destroyed = true;
+            break;
+        }
+    }
+
+    result->position = position;
+    result->velocity = velocity;
+}
@@ -0,0 +1,135 @@
+#ifndef FLAMING_CCD_H
+#define FLAMING_CCD_H
+
+// Sürekli çarpışma (CCD): beyaz top bir tick boyunca başlangıç konumundan
+// süpürülür ve ilk temas anı bulunur. Böylece düşük tick hızlarında ya da büyük
+// adımlarda top ince duvarların, lazerlerin ve engellerin içinden geçemez.
+//
+// Temas anları (tick'in kesri olarak):
+//   engel çemberi : hareket doğrusuyla çember arasındaki ikinci derece denklem (tam)
+//   duvar         : raylib PointLine bölgesi bir paralelkenardır; hareket doğrusu
+//                   dört yarı düzleme kırpılır (tam)
+//   lazer         : dönen parçanın kapalı çözümü yok; top ve lazer ucu iki örnek
+//                   arasında SIM_CCD_LASER_STEP'ten fazla ilerlemeyecek sıklıkta
+//                   örneklenir, ilk değen örnek ikiye bölmeyle daraltılır
+//   ekran kenarı  : sekme (SimBounceOffScreen ile aynı koşul)
+//
+// Olaylar zaman sırasıyla işlenir: engele çarpan top temas noktasından yansır ve
+// kalan süre yeni hızla süpürülür; duvar ya da lazer topu temas noktasında yakar.
+// Sahne motorlardan bağımsızdır; adayları SimStep ile SimStepBatch'in ortak
+// tick gövdesi (flaming_rules.h, SimTickRun) doldurur.
+//
+// Ateş topları bundan ayrı, UpdateFireballs'ta topun tick başındaki konumuna
+// karşı süpürülür (SimSweptCircleHit). Topun kendi hareketi ateş toplarına
+// karşı süpürülmez; ikisinin toplam çapı (56 px) ancak saniyede ~12 tick'in
+// altında atlanabilir.
+
+#include "flaming_sim.h"
+#include "flaming_simd.h"
+#include <math.h>
+
+#define SIM_CCD_MAX_EVENTS 16     // Tick başına en fazla sekme/çarpışma; sonrası olaysız tamamlanır
+#define SIM_CCD_LASER_STEP 8.0f   // Lazer örnekleri arasında top + uç yer değiştirmesi (px); lazer bandı ~37 px
+#define SIM_CCD_MAX_SAMPLES 4096  // Lazer başına örnek sınırı (çok büyük adımlar için)
+#define SIM_CCD_BISECT_STEPS 20
+#define SIM_CCD_REACH_MARGIN 1.0f // Erişim ön testinin float yuvarlamasına payı (px)
+
+typedef struct {
+    // Aday engeller (aktif ve patlamayanlar); ilk laserCount tanesi lazer
+    int obstacleCount;
+    int laserCount;
+    int obstacleIndex[NUM_OBSTACLES];
+    Vector2 obstaclePosition[NUM_OBSTACLES];
+    float obstacleRadius[NUM_OBSTACLES];
+    Vector2 laserDirection[NUM_OBSTACLES];  // Tick başındaki yön
+    float laserTurn;  // Tick boyunca tüm lazerlerin dönüşü (derece)
+    float laserBand;  // Lazer doğrusuna bundan uzak nokta tick boyunca lazere değemez (SimLaserBand)
+
+    // Aday duvarlar; wallIndices NULL ise tablonun ilk wallCount duvarı
+    const SimSegmentTable *walls;
+    const uint16_t *wallIndices;
+    int wallCount;
+    SimSegmentKernelFn wallKernel;  // NULL ise SimSegmentFirstEnter; ikisi bit bit aynıdır
+
+    Vector2 origin;  // Topun tick başındaki konumu
+    float reach;     // Topun tick boyunca gidebileceği yol; sekmeler hızı korur
+    float coreRadius;
+    float screenWidth;
+    float screenHeight;
+} SimCcdScene;
+
+typedef struct {
+    Vector2 position;  // Tick sonundaki ya da yanma anındaki konum
+    Vector2 velocity;
+    bool destroyed;    // Duvar ya da lazer değdi
+    int hitCount;
+    int hits[NUM_OBSTACLES];  // Çarpılan engellerin indeksleri, çarpışma sırasıyla
+} SimCcdResult;
+
+// Sahneyi boşaltır; adaylar önce lazerler, sonra diğer engeller olarak eklenir.
+// Ekleme, topun bu tick'te değemeyeceği adayları baştan eler: SimCcdResolve
+// onlar için zaten olay bulmazdı, sonuç değişmez ama süpürmeleri atlanır.
+static inline void SimCcdBegin(SimCcdScene *scene, Vector2 position, float sweep, float coreRadius,
+                               float laserTurn, float laserBand) {
+    scene->obstacleCount = 0;
+    scene->laserCount = 0;
+    scene->laserTurn = laserTurn;
+    scene->laserBand = laserBand;
+    scene->origin = position;
+    scene->reach = sweep;
+    scene->coreRadius = coreRadius;
+}
+
+// Top tick boyunca engel çemberine (radius + topun yarıçapı) değebilir mi
+static inline bool SimCcdCircleReachable(const SimCcdScene *scene, Vector2 position, float radius) {
+    float dx = position.x - scene->origin.x;
+    float dy = position.y - scene->origin.y;
+    float limit = radius + scene->coreRadius + scene->reach + SIM_CCD_REACH_MARGIN;
+    return (dx * dx + dy * dy) <= limit * limit;
+}
+
+// Top tick boyunca dönen lazere değebilir mi: topun merkezi lazer doğrusuna
+// laserBand'e ek olarak en çok reach kadar yaklaşabilir. direction tick
+// başındaki yöndür.
+static inline bool SimCcdLaserReachable(const SimCcdScene *scene, Vector2 position, Vector2 direction) {
+    float dx = scene->origin.x - position.x;
+    float dy = scene->origin.y - position.y;
+    float along = fminf(fmaxf(dx * direction.x + dy * direction.y, 0.0f), (float)LASER_LENGTH);
+    float ex = dx - along * direction.x;
+    float ey = dy - along * direction.y;
+    float limit = scene->laserBand + scene->reach + SIM_CCD_REACH_MARGIN;
+    return (ex * ex + ey * ey) <= limit * limit;
+}
+
+// Lazeri tick başındaki yönüyle sahneye ekler (diğer engellerden önce); tick
+// içindeki yönü bundan ve sahnenin ortak dönüşünden bulunur. Lazer çemberiyle de
+// çarpıştığından iki testten birini geçmesi yeter.
+static inline void SimCcdAddLaser(SimCcdScene *scene, int index, Vector2 position, float radius, Vector2 direction) {
+    if (!SimCcdCircleReachable(scene, position, radius) && !SimCcdLaserReachable(scene, position, direction)) {
+        return;
+    }
+
+    int k = scene->obstacleCount++;
+    scene->laserCount++;
+    scene->obstacleIndex[k] = index;
+    scene->obstaclePosition[k] = position;
+    scene->obstacleRadius[k] = radius;
+    scene->laserDirection[k] = direction;
+}
+
+// Yalnızca çemberiyle çarpışan engeli sahneye ekler
+static inline void SimCcdAddCircle(SimCcdScene *scene, int index, Vector2 position, float radius) {
+    if (!SimCcdCircleReachable(scene, position, radius)) return;
+
+    int k = scene->obstacleCount++;
+    scene->obstacleIndex[k] = index;
+    scene->obstaclePosition[k] = position;
+    scene->obstacleRadius[k] = radius;
+}
+
+// === Fonksiyon prototipleri ===
+// Top position'dan velocity * stepTime kadar ilerler (stepTime: dt * timeScale)
+void SimCcdResolve(const SimCcdScene *scene, Vector2 position, Vector2 velocity, float stepTime,
+                   SimCcdResult *result);
+
+#endif // FLAMING_CCD_H
@@ -0,0 +1,699 @@
+#include "flaming_event.h"
+#include "flaming_rules.h"
+#include "flaming_sdf.h"
+#include <float.h>
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#define EVENT_PI 3.14159265358979323846
+#define EVENT_MARGIN 1.0          // px; konum birikimlerindeki yuvarlamaya ve CCD'nin float testlerine pay
+#define EVENT_DRIFT 1e-3          // px/tick; kapalı biçimli adımın gerçek hızdan en fazla sapması
+#define EVENT_ANGLE_MARGIN 0.01   // rad; lazer ucu float cosf/sinf ile hesaplanır
+#define EVENT_LASER_STEP 4.0      // px; lazer temas örnekleri arasında top + lazer yer değiştirmesi
+#define EVENT_LASER_SAMPLES 2048  // Lazer başına örnek sınırı; aşılırsa ufuk orada kesilir
+
+// === Tekrarlanan float toplaması ===
+// x'e her tick aynı c eklenir. x ve sonuç aynı binade'deyse (aynı üs, aynı ulp)
+// toplamın yuvarlanması x'in kendisine değil yalnızca c'ye bağlıdır; tek istisna
+// c'nin tam yarım ulp'e düştüğü eşitlik durumudur (çift sayıya yuvarlama x'in
+// son bitine bakar). Bu yüzden bir binade içindeki adımlar x + n * r olarak
+// atılır; eşitlik x'in bir ulp yanındaki komşusuyla karşılaştırılarak yakalanır.
+typedef struct {
+    double amount;
+    bool inDouble;  // true: (float)((double)x + amount) (CCD), false: x + (float)amount
+} FloatStep;
+
+static inline float ApplyStep(float x, FloatStep step) {
+    return step.inDouble ? (float)((double)x + step.amount) : x + (float)step.amount;
+}
+
+// Sonucun stop'u geçtiği adım: artarken >= stop, azalırken < stop
+static inline bool CrossesStop(float value, FloatStep step, const float *stop) {
+    if (stop == NULL) return false;
+    return (step.amount > 0.0) ? (value >= *stop) : (value < *stop);
+}
+
+static inline uint32_t FloatBits(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static inline float BitsFloat(uint32_t bits) {
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// next = ApplyStep(*value) ile başlayan ve hep aynı binade'de kalan adım sayısı
+// (en fazla count); sonuç *value'ya yazılır. Kapalı biçim uygulanamıyorsa 0.
+// Bir binade'deki float'lar bit düzeninde ardışık tam sayılardır; adım ulp
+// cinsinden sabit bir tam sayı olarak ilerletilir.
+static int BinadeRun(float *value, float next, FloatStep step, int count, const float *stop) {
+    uint32_t bits = FloatBits(*value);
+    uint32_t nextBits = FloatBits(next);
+    uint32_t sign = bits & 0x80000000u;
+    int64_t magnitude = bits & 0x7FFFFFFFu;
+    int64_t nextMagnitude = nextBits & 0x7FFFFFFFu;
+    uint32_t exponent = (uint32_t)(magnitude >> 23);
+
+    if ((nextBits & 0x80000000u) != sign || exponent == 0 || exponent >= 0xFF) return 0;
+    if ((uint32_t)(nextMagnitude >> 23) != exponent) return 0;
+
+    // Yuvarlama komşuluğu binade'den taşmasın diye kenarlarda bir ulp pay
+    int64_t low = ((int64_t)exponent << 23) + 1;
+    int64_t high = ((int64_t)(exponent + 1) << 23) - 2;
+    int64_t delta = nextMagnitude - magnitude;
+    if (nextMagnitude < low || nextMagnitude > high) return 0;
+
+    int64_t neighbor = (magnitude + 1 <= high) ? magnitude + 1 : magnitude - 1;
+    int64_t neighborNext = FloatBits(ApplyStep(BitsFloat(sign | (uint32_t)neighbor), step)) & 0x7FFFFFFFu;
+    if (neighborNext < low || neighborNext > high || neighborNext - neighbor != delta) return 0;
+
+    int64_t fit = (delta > 0) ? (high - magnitude) / delta : (magnitude - low) / -delta;
+    if (stop != NULL) {
+        double rate = (double)next - (double)*value;
+        double toStop = ((double)*stop - (double)*value) / rate;
+        int64_t before = (toStop < (double)INT32_MAX) ? (int64_t)toStop : INT32_MAX;
+        if (rate > 0.0 && (double)before == toStop) before--;
+        if (before < fit) fit = before;
+    }
+
+    int run = (fit < count) ? (int)fit : count;
+    while (run > 0 && CrossesStop(BitsFloat(sign | (uint32_t)(magnitude + run * delta)), step, stop)) run--;
+    if (run <= 0) return 0;
+
+    *value = BitsFloat(sign | (uint32_t)(magnitude + run * delta));
+    return run;
+}
+
+// *value'ya en fazla count adım uygular; stop verilmişse onu geçecek adımdan önce
+// durur. Atılan adım sayısını döndürür, sonuç tek tek toplamayla bit bit aynıdır.
+static int RunFloat(float *value, FloatStep step, int count, const float *stop) {
+    float x = *value;
+    int done = 0;
+
+    while (done < count) {
+        float next = ApplyStep(x, step);
+        if (CrossesStop(next, step, stop)) break;
+
+        // Adım x'i değiştirmiyorsa sonrakiler de değiştirmez
+        if (next == x && signbit(next) == signbit(x)) {
+            done = count;
+            break;
+        }
+
+        if (count - done > 8) {
+            float end = x;
+            int run = BinadeRun(&end, next, step, count - done, stop);
+            if (run > 0) {
+                x = end;
+                done += run;
+                continue;
+            }
+        }
+
+        x = next;
+        done++;
+    }
+
+    *value = x;
+    return done;
+}
+
+// value'nun ticks[0] < ticks[1] < ... adımlarındaki değerlerini out'a yazar; sonuç
+// tek tek toplamayla bit bit aynıdır. Aynı binade'de kalan örnekler ulp adımının
+// katları olarak yazılır.
+static void RunFloatSamples(float value, FloatStep step, const int *ticks, int count, float *out) {
+    int at = 0;
+    int i = 0;
+    while (i < count) {
+        float next = ApplyStep(value, step);
+        float end = value;
+        int run = (next != value) ? BinadeRun(&end, next, step, ticks[count - 1] - at, NULL) : 0;
+        if (ticks[i] - at <= run) {
+            uint32_t sign = FloatBits(value) & 0x80000000u;
+            int64_t magnitude = FloatBits(value) & 0x7FFFFFFFu;
+            int64_t delta = (int64_t)(FloatBits(next) & 0x7FFFFFFFu) - magnitude;
+            for (; i < count && ticks[i] - at <= run; i++) {
+                out[i] = BitsFloat(sign | (uint32_t)(magnitude + (ticks[i] - at) * delta));
+            }
+        }
+        else {
+            RunFloat(&value, step, ticks[i] - at, NULL);
+            out[i++] = value;
+        }
+        value = out[i - 1];
+        at = ticks[i - 1];
+    }
+}
+
+// === Olay ufku ===
+// gap tick başına en fazla rate kapanıyorsa gap'in pay altına inmeyeceği tick sayısı
+static int DistanceTicks(double gap, double rate, int ticks) {
+    gap -= EVENT_MARGIN;
+    if (gap <= 0.0) return 0;
+    if (rate <= 0.0) return ticks;
+
+    double fit = gap / rate - 1.0;
+    if (fit < 1.0) return 0;
+    return (fit < ticks) ? (int)fit : ticks;
+}
+
+// value'ya her tick step eklenirken stop'a varmadan geçen tick sayısı. Tek tek
+// toplamadaki yuvarlama tick başına en fazla yarım ulp (<= |x| * FLT_EPSILON / 2)
+// sapar; ufuk bu birikim kadar erken kesilir.
+static int TimerTicks(float value, double step, float stop, int ticks) {
+    double gap = ((double)stop - value) / step;
+    if (gap <= 0.0) return 0;
+
+    double magnitude = fmax(fabs((double)value), fabs((double)stop));
+    double fit = gap - 2.0 - gap * magnitude * FLT_EPSILON / fabs(step);
+    if (fit < 1.0) return 0;
+    return (fit < ticks) ? (int)fit : ticks;
+}
+
+// Doğrusal giden nokta (merkeze göre d + w * t, t tick cinsinden) merkeze ilk kez
+// radius kadar yaklaştığı an; hiç yaklaşmıyorsa sonsuz
+static double ContactTime(double dx, double dy, double wx, double wy, double radius) {
+    double c = dx * dx + dy * dy - radius * radius;
+    if (c <= 0.0) return 0.0;
+
+    double a = wx * wx + wy * wy;
+    double b = dx * wx + dy * wy;
+    if (a == 0.0 || b >= 0.0) return INFINITY;  // Uzaklaşıyor
+
+    double discriminant = b * b - a * c;
+    if (discriminant < 0.0) return INFINITY;
+    return (-b - sqrt(discriminant)) / a;
+}
+
+// Temas time anındaysa ondan önce biten tam tick sayısı (CCD her tick'in
+// tamamını süpürür)
+static int ContactTicks(double time, int ticks) {
+    double fit = time - 1.0;
+    if (fit < 1.0) return 0;
+    return (fit < ticks) ? (int)fit : ticks;
+}
+
+// Doğrusal giden nokta (merkeze göre d + w * t) ile yarıçapı her tick speed kadar
+// büyüyen diskin ilk kesiştiği an; hiç kesişmiyorsa sonsuz. Yönü henüz belli
+// olmayan ateş topunun erişebileceği bölge budur.
+static double ReachTime(double dx, double dy, double wx, double wy, double radius, double speed) {
+    double c = dx * dx + dy * dy - radius * radius;
+    if (c <= 0.0) return 0.0;
+
+    double a = wx * wx + wy * wy - speed * speed;
+    double b = dx * wx + dy * wy - radius * speed;
+    if (a == 0.0) return (b < 0.0) ? -c / (2.0 * b) : INFINITY;
+
+    double discriminant = b * b - a * c;
+    if (discriminant < 0.0 || (a > 0.0 && b >= 0.0)) return INFINITY;
+    return (-b - sqrt(discriminant)) / a;
+}
+
+// Doğrusal giden noktanın (t tick cinsinden from + w * t) SimSegmentHit bölgesine,
+// her yanı margin kadar genişletilmiş haliyle ilk girdiği an; girmiyorsa sonsuz.
+// SimSegmentEnter'ın double'daki, süpürmeyle sınırlanmamış karşılığıdır.
+static double SegmentTime(const SimSegmentTable *table, int i, Vector2 from, double wx, double wy, double margin) {
+    double deltaX = table->deltaX[i];
+    double deltaY = table->deltaY[i];
+    double cross = ((double)from.x - table->originX[i]) * deltaY - ((double)from.y - table->originY[i]) * deltaX;
+    double crossRate = wx * deltaY - wy * deltaX;
+    double limit = table->limit[i] + margin * 1.41421356 * fmax(fabs(deltaX), fabs(deltaY));  // >= margin * uzunluk
+    double enter = 0.0;
+    double leave = INFINITY;
+
+    if (crossRate != 0.0) {
+        double t1 = (-limit - cross) / crossRate;
+        double t2 = (limit - cross) / crossRate;
+        enter = fmax(enter, fmin(t1, t2));
+        leave = fmin(leave, fmax(t1, t2));
+    }
+    else if (fabs(cross) >= limit) {
+        return INFINITY;
+    }
+
+    double coordinate = table->axisMask[i] ? from.y : from.x;
+    double coordinateRate = table->axisMask[i] ? wy : wx;
+    double low = table->low[i] - margin;
+    double high = table->high[i] + margin;
+    if (coordinateRate != 0.0) {
+        double t1 = (low - coordinate) / coordinateRate;
+        double t2 = (high - coordinate) / coordinateRate;
+        enter = fmax(enter, fmin(t1, t2));
+        leave = fmin(leave, fmax(t1, t2));
+    }
+    else if (coordinate < low || coordinate > high) {
+        return INFINITY;
+    }
+
+    return (enter <= leave) ? enter : INFINITY;
+}
+
+static double SegmentDistance(Vector2 point, Vector2 start, Vector2 end) {
+    double sx = (double)end.x - start.x;
+    double sy = (double)end.y - start.y;
+    double dx = (double)point.x - start.x;
+    double dy = (double)point.y - start.y;
+    double length = sx * sx + sy * sy;
+    double t = (length > 0.0) ? (dx * sx + dy * sy) / length : 0.0;
+    t = fmin(fmax(t, 0.0), 1.0);
+    double ex = dx - sx * t;
+    double ey = dy - sy * t;
+    return sqrt(ex * ex + ey * ey);
+}
+
+// Açıyı [0, 2pi) aralığına getirir; girdiler birkaç turdan büyük değildir
+static double WrapAngle(double angle) {
+    while (angle < 0.0) angle += 2.0 * EVENT_PI;
+    while (angle >= 2.0 * EVENT_PI) angle -= 2.0 * EVENT_PI;
+    return angle;
+}
+
+// İki yay [start, start + length] çember üzerinde ayrık mı
+static bool ArcsDisjoint(double start1, double length1, double start2, double length2) {
+    return WrapAngle(start2 - start1) > length1 && WrapAngle(start1 - start2) > length2;
+}
+
+static inline double LaserFarthest(int threshold) {
+    double along = LASER_LENGTH + threshold;
+    return sqrt(along * along + (double)threshold * threshold);
+}
+
+// Top n tick boyunca lazere değemez mi. SimPointNearLine'ın bölgesi merkezden en
+// fazla sqrt((L + eşik)^2 + eşik^2) uzaktadır; merkeze uzaklığı >= 2 * eşik olan
+// noktayı da ancak lazer doğrultusuyla açısı asin(eşik / uzaklık)'tan küçükse
+// kabul eder (arka yöndeki koni baskın eksen aralığının dışında kalır). Top
+// doğru boyunca gittiği için merkezden görünen açısı iki uç arasında tekdüze
+// değişir; lazerin n tick'te taradığı yay bununla kesişmiyorsa temas yoktur.
+static bool LaserClear(Vector2 position, Vector2 direction, Vector2 core, Vector2 velocity, double stepTime,
+                       double turn, int threshold, int n) {
+    double dx = (double)core.x - position.x;
+    double dy = (double)core.y - position.y;
+    double ex = dx + (double)velocity.x * stepTime * n;
+    double ey = dy + (double)velocity.y * stepTime * n;
+    double nearest = SegmentDistance(position, core,
+                                     (Vector2){ (float)(core.x + ex - dx), (float)(core.y + ey - dy) });
+    nearest -= EVENT_MARGIN + n * EVENT_DRIFT;
+
+    double farthest = LaserFarthest(threshold);
+    if (nearest > farthest) return true;
+    if (nearest < 2.0 * threshold) return false;
+
+    double halfWidth = asin(threshold / nearest) + EVENT_ANGLE_MARGIN;
+    double from = atan2(dy, dx);
+    double sweep = WrapAngle(atan2(ey, ex) - from);
+    if (sweep > EVENT_PI) sweep -= 2.0 * EVENT_PI;
+    double coreStart = (sweep < 0.0) ? from + sweep : from;
+
+    double laserStart = atan2(direction.y, direction.x) - halfWidth;  // Radyan; yay testleri sarmayı kendisi yapar
+    return ArcsDisjoint(laserStart, n * turn + 2.0 * halfWidth, coreStart - EVENT_ANGLE_MARGIN,
+                        fabs(sweep) + 2.0 * EVENT_ANGLE_MARGIN);
+}
+
+// Top ile dönen lazerin ilk temas anı için alt sınır (tick); ticks içinde temas
+// yoksa sonsuz. CCD'deki LaserTime gibi örnekler: örnekler arasında top ve
+// lazerin erişim içindeki her noktası toplam EVENT_LASER_STEP'ten fazla
+// ilerlemez, bölge de bu kadar ve margin kadar genişletilir. SimPointNearLine'ın
+// bölgesi lazere dik uzaklıkta eşik * max(|cos|, |sin|)'ten, boyunca da
+// [-dik uzaklık, L + dik uzaklık] aralığından taşmaz.
+static double LaserContactTime(Vector2 position, Vector2 direction, Vector2 core, double wx, double wy,
+                               double turn, int threshold, double margin, int ticks) {
+    double dx = (double)core.x - position.x;
+    double dy = (double)core.y - position.y;
+    double farthest = LaserFarthest(threshold);
+    double band = EVENT_LASER_STEP + margin;
+    double reach = farthest + band;
+
+    // Örnekleme top erişime girdiğinde başlar, çıkıp uzaklaştığında biter
+    double time = ContactTime(dx, dy, wx, wy, reach);
+    if (time >= ticks) return INFINITY;
+
+    double motion = sqrt(wx * wx + wy * wy) + turn * (reach + threshold);
+    double spacing = (motion > 0.0) ? EVENT_LASER_STEP / motion : ticks + 1.0;
+    double angle = atan2(direction.y, direction.x) + turn * time;
+    double cx = cos(angle);
+    double cy = sin(angle);
+    double stepX = cos(turn * spacing);
+    double stepY = sin(turn * spacing);
+
+    for (int sample = 0; sample < EVENT_LASER_SAMPLES; sample++, time += spacing) {
+        if (time > ticks) return INFINITY;
+
+        double qx = dx + wx * time;
+        double qy = dy + wy * time;
+        double across = fabs(qx * cy - qy * cx);
+        double along = qx * cx + qy * cy;
+        if (across < threshold * fmax(fabs(cx), fabs(cy)) + band &&
+            along >= -across - 2.0 * band && along <= LASER_LENGTH + across + 2.0 * band) {
+            return time;
+        }
+        if (qx * qx + qy * qy > reach * reach && qx * wx + qy * wy >= 0.0) return INFINITY;
+
+        double nx = cx * stepX - cy * stepY;
+        cy = cx * stepY + cy * stepX;
+        cx = nx;
+    }
+    return time;
+}
+
+static int LaserTicks(Vector2 position, Vector2 direction, Vector2 core, Vector2 velocity, double stepTime,
+                      double travel, double turn, int threshold, int quiet) {
+    double dx = (double)core.x - position.x;
+    double dy = (double)core.y - position.y;
+    int reachTicks = DistanceTicks(sqrt(dx * dx + dy * dy) - LaserFarthest(threshold), travel, quiet);
+    if (reachTicks >= quiet || LaserClear(position, direction, core, velocity, stepTime, turn, threshold, quiet)) {
+        return quiet;
+    }
+
+    // Yay testi tutmuyor: temas anı örneklenerek bulunur
+    double margin = EVENT_MARGIN + EVENT_DRIFT * quiet + EVENT_ANGLE_MARGIN * LaserFarthest(threshold);
+    double time = LaserContactTime(position, direction, core, (double)velocity.x * stepTime,
+                                   (double)velocity.y * stepTime, turn, threshold, margin, quiet);
+    return ContactTicks(time, quiet);
+}
+
+int SimQuietTicks(const GameWorld *world, float dt, int ticks) {
+    // Beyaz top patlarken SimStep yalnızca patlamayı ilerletir
+    if (world->explosionActive) return TimerTicks(world->explosionDuration, dt, CORE_EXPLOSION_DURATION, ticks);
+    if (world->gameOver || world->victory) return 0;
+
+    int quiet = ticks;
+    float stepTime = dt * world->timeScale;
+
+    // Zamanlayıcılar: patlama sonu
+    const uint16_t *order = world->obstacleOrder;
+    int alive = world->aliveObstacles;
+    for (int k = alive; k < alive + world->explodingObstacles && quiet > 0; k++) {
+        quiet = TimerTicks(world->obstacles[order[k]].explosionTimer, dt, OBSTACLE_EXPLOSION_DURATION, quiet);
+    }
+    if (quiet < SIM_EVENT_MIN_JUMP) return quiet;
+
+    Vector2 core = world->corePosition;
+    float coreRadius = world->coreRadius;
+    double travel = sqrt((double)world->velocity.x * world->velocity.x +
+                         (double)world->velocity.y * world->velocity.y) * stepTime;
+    if (travel > 0.0) travel += EVENT_DRIFT;
+    double coreMoveX = (double)world->velocity.x * stepTime;
+    double coreMoveY = (double)world->velocity.y * stepTime;
+
+    // Ateş topları: ekrandan çıkma, ömür ve topa çarpma
+    float left = -FIREBALL_SCREEN_MARGIN;
+    float right = world->screenWidth + FIREBALL_SCREEN_MARGIN;
+    float top = -FIREBALL_SCREEN_MARGIN;
+    float bottom = world->screenHeight + FIREBALL_SCREEN_MARGIN;
+
+    const FireballSet *fireballs = &world->fireballs;
+    for (int w = 0; w < SIM_FIREBALL_WORDS; w++) {
+        for (uint64_t slots = world->fireballSlots[w]; slots != 0 && quiet >= SIM_EVENT_MIN_JUMP; slots &= slots - 1) {
+            int i = w * 64 + __builtin_ctzll(slots);
+
+            float moveX = fireballs->velocityX[i] * stepTime;
+            float moveY = fireballs->velocityY[i] * stepTime;
+            if (moveX != 0.0f) quiet = TimerTicks(fireballs->x[i], moveX, (moveX < 0.0f) ? left : right, quiet);
+            if (moveY != 0.0f) quiet = TimerTicks(fireballs->y[i], moveY, (moveY < 0.0f) ? top : bottom, quiet);
+            quiet = TimerTicks(fireballs->lifeTime[i], stepTime, FIREBALL_LIFETIME, quiet);
+
+            // Tick j'de ateş topu j..j+1 arasını süpürür, top j'deki konumundadır; göreli
+            // doğrusal hareketle arası en fazla topun tick başı yolu kadar farklıdır
+            double radius = fireballs->radius[i] + coreRadius + travel + EVENT_MARGIN + 2.0 * EVENT_DRIFT * quiet;
+            double time = ContactTime((double)fireballs->x[i] - core.x, (double)fireballs->y[i] - core.y,
+                                      moveX - coreMoveX, moveY - coreMoveY, radius);
+            quiet = ContactTicks(time, quiet);
+        }
+    }
+
+    // Shooter ateşlemesi atlamanın içinde yapılır (SkipQuietTicks); ufku ikinci
+    // ateşleme ve doğacak ateş topu kısaltır. Ateş topunun yönü doğduğu tick'teki
+    // top konumuna bağlıdır; yöne bakılmaz, en erken ateşleme tick'inden m tick
+    // sonra doğduğu yerden en fazla m tick'lik yol uzakta olabilir.
+    const ShooterSet *shooters = &world->shooters;
+    double fireballMove = FIREBALL_SPEED * stepTime + EVENT_DRIFT;
+    for (int a = 0; a < shooters->aliveCount && quiet >= SIM_EVENT_MIN_JUMP; a++) {
+        int k = shooters->alive[a];
+        int before = TimerTicks(shooters->shootTimer[k], stepTime, shooters->shootInterval[k], quiet);
+        if (before >= quiet) continue;
+
+        int fire = before + 1;
+        Vector2 origin = world->obstacles[shooters->obstacle[k]].position;
+        double edge = fmin(fmin(origin.x - left, right - origin.x), fmin(origin.y - top, bottom - origin.y));
+        int rest = TimerTicks(0.0f, stepTime, shooters->shootInterval[k], quiet);
+        rest = TimerTicks(0.0f, stepTime, FIREBALL_LIFETIME, rest);
+        rest = DistanceTicks(edge, fireballMove, rest);
+        if (fire + rest < quiet) quiet = fire + rest;
+
+        double radius = FIREBALL_RADIUS + coreRadius + EVENT_MARGIN + 2.0 * EVENT_DRIFT * quiet;
+        double time = ReachTime((double)core.x + coreMoveX * fire - origin.x, (double)core.y + coreMoveY * fire - origin.y,
+                                coreMoveX, coreMoveY, radius + fireballMove, fireballMove);
+        quiet = ContactTicks(fire + 1.0 + time, quiet);
+    }
+    if (quiet < SIM_EVENT_MIN_JUMP) return quiet;
+
+    // Ekran kenarları (SimBounceOffScreen koşulu)
+    if (world->velocity.x != 0.0f) {
+        double gap = (world->velocity.x < 0.0f) ? core.x - coreRadius : world->screenWidth - (core.x + coreRadius);
+        quiet = DistanceTicks(gap, fabs((double)world->velocity.x * stepTime) + EVENT_DRIFT, quiet);
+    }
+    if (world->velocity.y != 0.0f) {
+        double gap = (world->velocity.y < 0.0f) ? core.y - coreRadius : world->screenHeight - (core.y + coreRadius);
+        quiet = DistanceTicks(gap, fabs((double)world->velocity.y * stepTime) + EVENT_DRIFT, quiet);
+    }
+
+    // Engel çemberleri: tek bir doğru boyunca temas anı
+    for (int k = 0; k < alive && quiet >= SIM_EVENT_MIN_JUMP; k++) {
+        const Obstacle *obstacle = &world->obstacles[order[k]];
+
+        double radius = coreRadius + obstacle->radius + EVENT_MARGIN + EVENT_DRIFT * quiet;
+        double time = ContactTime((double)core.x - obstacle->position.x, (double)core.y - obstacle->position.y,
+                                  coreMoveX, coreMoveY, radius);
+        quiet = ContactTicks(time, quiet);
+    }
+
+    // Duvarlar: SimSegmentHit bölgesine doğrusal hareketin giriş anı. Ufuk boyunca
+    // gidilecek yol uzaklık alanının alt sınırına sığıyorsa duvarlara bakılmaz.
+    const SimSdf *sdf = SimWorldSdf(world);
+    bool wallsNear = (world->level >= 2) &&
+                     (sdf == NULL || SimSdfLowerBound(sdf, core) <= sdf->coreReach + travel * (quiet + 1) + EVENT_MARGIN);
+    if (wallsNear) {
+        for (int i = 0; i < MAX_DEADLY_WALLS && quiet >= SIM_EVENT_MIN_JUMP; i++) {
+            const DeadlyWall *wall = &world->deadlyWalls[i];
+            if (!wall->active) continue;
+
+            double margin = EVENT_MARGIN + EVENT_DRIFT * quiet;
+            quiet = ContactTicks(SegmentTime(&world->wallSegments, i, core, coreMoveX, coreMoveY, margin), quiet);
+        }
+    }
+
+    // Lazerler en pahalı test; ufuk artık kısaldıysa gerek kalmaz
+    double turnDegrees = SimLaserPhaseStep(world->bulletTimeActive) * SIM_LASER_STEP_DEGREES * dt;
+    double turn = turnDegrees * (EVENT_PI / 180.0) + 1e-9;
+    int threshold = SimLaserThreshold(coreRadius);
+
+    const LaserSet *lasers = &world->lasers;
+    for (int a = 0; a < lasers->aliveCount && quiet >= SIM_EVENT_MIN_JUMP; a++) {
+        int k = lasers->alive[a];
+        const Obstacle *obstacle = &world->obstacles[lasers->obstacle[k]];
+        quiet = LaserTicks(obstacle->position, lasers->direction[k], core, world->velocity, stepTime, travel, turn,
+                           threshold, quiet);
+    }
+
+    return quiet;
+}
+
+// === Olaysız tick'leri atlama ===
+// SimStep'in olaysız bir tick'te yaptığı güncellemelerin n tekrarı; her alan
+// SimStep'teki ifadeyle aynı float işlemleriyle ilerletilir.
+static void SkipQuietTicks(GameWorld *world, float dt, int n) {
+    float stepTime = dt * world->timeScale;
+    FloatStep realStep = { dt, false };
+    FloatStep timerStep = { stepTime, false };
+
+    world->tick += n;
+    RunFloat(&world->levelTime, realStep, n, NULL);
+
+    if (world->explosionActive) {
+        RunFloat(&world->explosionDuration, realStep, n, NULL);
+        return;
+    }
+
+    // Lazer yönleri adım sayısından kapalı biçimde hesaplanır
+    world->laserPhase += (uint32_t)n * SimLaserPhaseStep(world->bulletTimeActive);
+    float laserTurn = SimLaserTurnAt(world->laserPhase, dt);
+
+    const uint16_t *order = world->obstacleOrder;
+    int alive = world->aliveObstacles;
+    for (int k = alive; k < alive + world->explodingObstacles; k++) {
+        RunFloat(&world->obstacles[order[k]].explosionTimer, realStep, n, NULL);
+    }
+
+    LaserSet *lasers = &world->lasers;
+    Vector2 turnDirection = SimLaserDirection(laserTurn);
+    for (int k = 0; k < lasers->count; k++) {
+        lasers->direction[k] = SimRotate(lasers->baseDirection[k], turnDirection);
+    }
+
+    // Olaysız tick'te CCD topu (float)((double)x + v * stepTime) ile ilerletir
+    FloatStep moveX = { (double)world->velocity.x * stepTime, true };
+    FloatStep moveY = { (double)world->velocity.y * stepTime, true };
+
+    // Ateşlemeler: sayaç ateşleme tick'ine kadar ilerletilir, sıfırlanır ve kalan
+    // tick'ler sayılır (ufuk ikinci ateşlemeyi dışarıda bırakır). Kayıtlar tick
+    // sırasıyla, aynı tick'tekiler shooter sırasıyla tutulur.
+    ShooterSet *shooters = &world->shooters;
+    int fireTick[NUM_OBSTACLES];
+    int fireShooter[NUM_OBSTACLES];
+    int fires = 0;
+    float timerFrom = -1.0f;
+    float timerTo = -1.0f;
+    for (int a = 0; a < shooters->aliveCount; a++) {
+        int k = shooters->alive[a];
+
+        // Sayaçlar artar: son değer aralığın altındaysa ateşleme yoktur. Aynı
+        // değerden başlayan sayaçlar (levelin başından beri ateşlemeyenler) aynı
+        // sonuca varır.
+        if (shooters->shootTimer[k] != timerFrom) {
+            timerFrom = shooters->shootTimer[k];
+            timerTo = timerFrom;
+            RunFloat(&timerTo, timerStep, n, NULL);
+        }
+        if (timerTo < shooters->shootInterval[k]) {
+            shooters->shootTimer[k] = timerTo;
+            continue;
+        }
+
+        int before = RunFloat(&shooters->shootTimer[k], timerStep, n, &shooters->shootInterval[k]);
+
+        shooters->shootTimer[k] = 0.0f;
+        RunFloat(&shooters->shootTimer[k], timerStep, n - before - 1, NULL);
+
+        int f = fires++;
+        for (; f > 0 && fireTick[f - 1] > before + 1; f--) {
+            fireTick[f] = fireTick[f - 1];
+            fireShooter[f] = fireShooter[f - 1];
+        }
+        fireTick[f] = before + 1;
+        fireShooter[f] = k;
+    }
+
+    FireballSet *fireballs = &world->fireballs;
+    for (int w = 0; w < SIM_FIREBALL_WORDS; w++) {
+        for (uint64_t slots = world->fireballSlots[w]; slots != 0; slots &= slots - 1) {
+            int i = w * 64 + __builtin_ctzll(slots);
+
+            RunFloat(&fireballs->x[i], (FloatStep){ fireballs->velocityX[i] * stepTime, false }, n, NULL);
+            RunFloat(&fireballs->y[i], (FloatStep){ fireballs->velocityY[i] * stepTime, false }, n, NULL);
+            RunFloat(&fireballs->lifeTime[i], timerStep, n, NULL);
+        }
+    }
+
+    // Yeni ateş topları SimStep'teki sırayla boş slotlara doğar; hedef topun
+    // ateşleme tick'indeki konumudur, sonraki tick'lerde ilerlerler
+    SimTickState spawner = {
+        .fireballs = fireballs, .fireballSlots = world->fireballSlots, .fireballCapacity = world->fireballCapacity
+    };
+    Vector2 target = world->corePosition;
+    int aimed = 0;
+    for (int f = 0; f < fires; f++) {
+        RunFloat(&target.x, moveX, fireTick[f] - aimed, NULL);
+        RunFloat(&target.y, moveY, fireTick[f] - aimed, NULL);
+        aimed = fireTick[f];
+
+        int i = SimFireballFreeSlot(world->fireballSlots, world->fireballCapacity);
+        SimTickSpawnFireball(&spawner, world->obstacles[shooters->obstacle[fireShooter[f]]].position, target);
+        if (i < 0) continue;
+
+        int flight = n - fireTick[f];
+        RunFloat(&fireballs->x[i], (FloatStep){ fireballs->velocityX[i] * stepTime, false }, flight, NULL);
+        RunFloat(&fireballs->y[i], (FloatStep){ fireballs->velocityY[i] * stepTime, false }, flight, NULL);
+        RunFloat(&fireballs->lifeTime[i], timerStep, flight, NULL);
+    }
+
+    // Trail zamanlayıcısı tick tick sayılır (her birkaç tick'te örnek alınır).
+    // Örnekten sonra sayaç bir önceki örnektekiyle aynıysa sonraki örnekler aynı
+    // aralıkla aynen tekrarlar; tam tekrarlar tek seferde atılır. Yalnızca son
+    // TRAIL_LENGTH örneğin konumu hesaplanır.
+    int sampleTicks[TRAIL_LENGTH];
+    int samples = 0;
+    float trailTimer = world->trailTimer;
+    if (!world->trailActive) RunFloat(&trailTimer, realStep, n, NULL);
+
+    float sampledTimer = 0.0f;
+    int sampledTick = -1;
+    for (int t = 1; t <= n && world->trailActive; t++) {
+        trailTimer += dt;
+        if (trailTimer < TRAIL_SAMPLE_INTERVAL) continue;
+
+        trailTimer -= TRAIL_SAMPLE_INTERVAL;
+        sampleTicks[samples % TRAIL_LENGTH] = t;
+        samples++;
+
+        if (sampledTick >= 0 && trailTimer == sampledTimer) {
+            int period = t - sampledTick;
+            int repeats = (n - t) / period;
+            for (int r = (repeats > TRAIL_LENGTH) ? repeats - TRAIL_LENGTH + 1 : 1; r <= repeats; r++) {
+                sampleTicks[(samples + r - 1) % TRAIL_LENGTH] = t + r * period;
+            }
+            samples += repeats;
+            t += repeats * period;
+        }
+        sampledTimer = trailTimer;
+        sampledTick = t;
+    }
+    world->trailTimer = trailTimer;
+
+    // Konumlar örnek tick'lerinde ve atlamanın sonunda
+    int kept = (samples < TRAIL_LENGTH) ? samples : TRAIL_LENGTH;
+    int keptTicks[TRAIL_LENGTH + 1];
+    for (int s = 0; s < kept; s++) keptTicks[s] = sampleTicks[(samples - kept + s) % TRAIL_LENGTH];
+    keptTicks[kept] = n;
+
+    float x[TRAIL_LENGTH + 1];
+    float y[TRAIL_LENGTH + 1];
+    RunFloatSamples(world->corePosition.x, moveX, keptTicks, kept + 1, x);
+    RunFloatSamples(world->corePosition.y, moveY, keptTicks, kept + 1, y);
+    for (int s = 0; s < kept; s++) {
+        world->trail[(world->trailIndex + samples - kept + s) % TRAIL_LENGTH] = (Vector2){ x[s], y[s] };
+    }
+
+    world->corePosition = (Vector2){ x[kept], y[kept] };
+    world->trailIndex = (world->trailIndex + samples) % TRAIL_LENGTH;
+}
+
+// Girdi bu tick'te durumu değiştirmiyor mu (aynı girdi önceki tick'te zaten uygulandı)
+static bool InputSettled(const GameWorld *world, const SimInput *input) {
+    bool slowed = world->bulletTimeActive && world->timeScale == BULLET_TIME_SCALE;
+
+    if (input->toggleBulletTime) return false;
+    if (input->resumeFromPause && !slowed) return false;
+    if (world->explosionActive) return true;  // Patlamada nişan girdileri okunmaz
+    if (input->aimDown) {
+        return world->aiming && slowed &&
+               memcmp(&world->targetPosition, &input->aimTarget, sizeof(Vector2)) == 0;
+    }
+    return !(input->aimReleased && world->aiming);
+}
+
+int SimAdvance(GameWorld *world, const SimInput *input, float dt, int ticks, unsigned int *events) {
+    unsigned int happened = 0;
+    int done = 0;
+
+    while (done < ticks && happened == 0) {
+        int quiet = InputSettled(world, input) ? SimQuietTicks(world, dt, ticks - done) : 0;
+        if (quiet >= SIM_EVENT_MIN_JUMP) {
+            SkipQuietTicks(world, dt, quiet);
+            done += quiet;
+            continue;
+        }
+
+        // Ufuk kısa: birkaç tick normal adımla geçilir, ufuk sonra yeniden hesaplanır
+        for (int step = 0; step < SIM_EVENT_MIN_JUMP && done < ticks && happened == 0; step++) {
+            happened = SimStep(world, input, dt);
+            done++;
+        }
+    }
+
+    if (events != NULL) *events = happened;
+    return done;
+}
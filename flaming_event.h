@@ -0,0 +1,41 @@
+#ifndef FLAMING_EVENT_H
+#define FLAMING_EVENT_H
+
+// Olay güdümlü ilerletme: aynı girdiyle geçen tick'lerde bir sonraki olayın
+// (ekran kenarı, engel, duvar, lazer süpürmesi, ateş topunun çarpması ya da
+// sönmesi, patlamanın bitmesi) en erken tick'i hesaplanır ve oraya kadar olan
+// olaysız tick'ler tek seferde atlanır. Shooter ateşlemesi olay sayılmaz:
+// atlamanın içinde sayaç sıfırlanır ve ateş topu doğar.
+//
+// Sonuç SimStep'i her tick çağırmakla bit bit aynıdır; tekrar oynatma
+// doğrulamasında ve botlarda hash'ler değişmez. Bunun için sürekli zamana
+// geçilmez, tick tick yapılan float toplamaları kapalı biçimde yeniden üretilir:
+// x += c işlemi x aynı binade'de (aynı üs) kaldıkça her adımda aynı miktarı
+// ekler, bu yüzden bir binade içindeki adımlar tek çarpmayla atılır.
+//
+// Olay ufku:
+//   zamanlayıcılar (ömür, patlama, parçacık) : bölmeyle, biriken yuvarlama payıyla
+//   ekran kenarı                              : uzaklık / tick başı yol
+//   engel, ateş topu : doğrusal hareketin çembere ilk temas anı (pay bırakarak)
+//   duvar   : doğrusal hareketin SimSegmentHit bölgesine giriş anı (pay bırakarak)
+//   doğacak ateş topu : en erken ateşleme tick'inden sonra her tick ateş topunun
+//             yolu kadar büyüyen diske temas; ikinci ateşleme ufkun dışındadır
+//   lazer   : erişim dışındaysa uzaklıkla, lazer ile topun açısal arası ve
+//             dönüş hızıyla; bunlar yetmezse CCD gibi örneklenen temas anıyla
+// Ufuk olayın kendisini içermez; olaylı tick SimStep ile işlenir.
+
+#include "flaming_sim.h"
+
+#define SIM_EVENT_MIN_JUMP 4  // Daha kısa ufuklarda tick'ler SimStep ile işlenir
+
+// === Fonksiyon prototipleri ===
+// Dünyayı input ile en fazla ticks tick ilerletir; bir tick olay bayrağı
+// döndürürse o tick'ten sonra durur. İşlenen tick sayısını döndürür, olayları
+// *events'e yazar (NULL olabilir).
+int SimAdvance(GameWorld *world, const SimInput *input, float dt, int ticks, unsigned int *events);
+
+// Sonraki ticks tick'ten kaçının SimStep'te yalnızca entegrasyon ve shooter
+// ateşlemesi yapacağı (olay ya da sekme olmayacağı); input'un etkisi sabit varsayılır
+int SimQuietTicks(const GameWorld *world, float dt, int ticks);
+
+#endif // FLAMING_EVENT_H
@@ -0,0 +1,181 @@
+#include "flaming_grid.h"
+#include "flaming_rules.h"
+#include <math.h>
+#include <string.h>
+
+_Static_assert(NUM_OBSTACLES <= UINT16_MAX && MAX_DEADLY_WALLS <= UINT16_MAX, "SimGrid indeksleri uint16_t");
+_Static_assert(NUM_OBSTACLES + MAX_DEADLY_WALLS <= SIM_GRID_MAX_ENTRIES, "Tek hücreli ızgara her zaman sığmalı");
+
+#define GRID_FAR 1.0e9  // Kenar hücrelerinin dışarıya uzandığı mesafe
+#define GRID_MARGIN 1.0  // Kayan nokta yuvarlamalarına karşı pay
+
+// Etki alanı: a-b doğru parçası (çemberde a == b) ve çevresindeki reach kadarlık bölge
+typedef struct {
+    double ax, ay;
+    double bx, by;
+    double reach;
+} GridShape;
+
+static inline double GridMin(double a, double b) { return (a < b) ? a : b; }
+static inline double GridMax(double a, double b) { return (a > b) ? a : b; }
+
+// Koordinatın hücre sütunu/satırı; ızgara dışı kenara sıkıştırılır
+static inline int GridClampCell(double value, double cellSize, int cells) {
+    if (value <= 0.0) return 0;
+    if (value >= cells * cellSize) return cells - 1;
+    return (int)(value / cellSize);
+}
+
+// Şeklin bir satır bandı [y0, y1] içindeki x aralığı; banda değmiyorsa false.
+// Çemberde tam aralık, doğru parçasında reach kadar büyütülmüş kutunun aralığı
+// hesaplanır (kapsülü içerir).
+static bool ShapeRowSpan(const GridShape *shape, double y0, double y1, double *lo, double *hi) {
+    if (shape->ax == shape->bx && shape->ay == shape->by) {
+        double dy = GridMax(GridMax(y0 - shape->ay, 0.0), shape->ay - y1);
+        if (dy > shape->reach) return false;
+
+        double half = sqrt(shape->reach * shape->reach - dy * dy);
+        *lo = shape->ax - half;
+        *hi = shape->ax + half;
+        return true;
+    }
+
+    y0 -= shape->reach;
+    y1 += shape->reach;
+
+    double t0 = 0.0, t1 = 1.0;
+    double dy = shape->by - shape->ay;
+    if (dy == 0.0) {
+        if (shape->ay < y0 || shape->ay > y1) return false;
+    }
+    else {
+        double ta = (y0 - shape->ay) / dy;
+        double tb = (y1 - shape->ay) / dy;
+        t0 = GridMax(t0, GridMin(ta, tb));
+        t1 = GridMin(t1, GridMax(ta, tb));
+        if (t0 > t1) return false;
+    }
+
+    double xa = shape->ax + (shape->bx - shape->ax) * t0;
+    double xb = shape->ax + (shape->bx - shape->ax) * t1;
+    *lo = GridMin(xa, xb) - shape->reach;
+    *hi = GridMax(xa, xb) + shape->reach;
+    return true;
+}
+
+// Şeklin değdiği hücreler; sayısını döndürür. counts verilmişse hücre başına
+// sayılır, cursor verilmişse index hücrenin sıradaki yerine yazılır.
+static int VisitCells(SimGrid *grid, double cellSize, const GridShape *shape, int index, uint32_t *counts,
+                      uint32_t *cursor) {
+    int row0 = GridClampCell(GridMin(shape->ay, shape->by) - shape->reach - GRID_MARGIN, cellSize, grid->rows);
+    int row1 = GridClampCell(GridMax(shape->ay, shape->by) + shape->reach + GRID_MARGIN, cellSize, grid->rows);
+    int visited = 0;
+
+    for (int row = row0; row <= row1; row++) {
+        // Satır bandı; kenar satırlar dışarıya uzanır
+        double y0 = (row == 0) ? -GRID_FAR : row * cellSize - GRID_MARGIN;
+        double y1 = (row == grid->rows - 1) ? GRID_FAR : (row + 1) * cellSize + GRID_MARGIN;
+        double lo, hi;
+        if (!ShapeRowSpan(shape, y0, y1, &lo, &hi)) continue;
+
+        int col0 = GridClampCell(lo - GRID_MARGIN, cellSize, grid->cols);
+        int col1 = GridClampCell(hi + GRID_MARGIN, cellSize, grid->cols);
+
+        for (int col = col0; col <= col1; col++) {
+            int cell = row * grid->cols + col;
+            if (counts != NULL) counts[cell]++;
+            if (cursor != NULL) grid->entries[cursor[cell]++] = (uint16_t)index;
+        }
+        visited += col1 - col0 + 1;
+    }
+
+    return visited;
+}
+
+// Şekillerin hücrelere dağılımını CSR düzeninde yazar; entries yetmezse false.
+// İlk geçiş hücre başına sayar, ikincisi yazar. Şekiller indeks sırasıyla
+// gezildiği için her hücrede indeksler artan kalır.
+static bool FillCells(SimGrid *grid, double cellSize, const GridShape *shapes, const bool *used, int count,
+                      uint32_t *start, uint32_t entryBase) {
+    int cells = grid->cols * grid->rows;
+    uint32_t counts[SIM_GRID_MAX_CELLS] = { 0 };
+    int64_t total = 0;
+
+    for (int i = 0; i < count; i++) {
+        if (used[i]) total += VisitCells(grid, cellSize, &shapes[i], i, counts, NULL);
+    }
+    if (entryBase + total > SIM_GRID_MAX_ENTRIES) return false;
+
+    start[0] = entryBase;
+    for (int c = 0; c < cells; c++) {
+        start[c + 1] = start[c] + counts[c];
+        counts[c] = start[c];
+    }
+    for (int i = 0; i < count; i++) {
+        if (used[i]) VisitCells(grid, cellSize, &shapes[i], i, NULL, counts);
+    }
+
+    return true;
+}
+
+static bool GridFill(SimGrid *grid, double cellSize, const GridShape *obstacleShapes, const bool *obstacleUsed,
+                     int obstacleCount, const GridShape *wallShapes, const bool *wallUsed, int wallCount) {
+    int cells = grid->cols * grid->rows;
+
+    if (!FillCells(grid, cellSize, obstacleShapes, obstacleUsed, obstacleCount, grid->obstacleStart, 0)) return false;
+    return FillCells(grid, cellSize, wallShapes, wallUsed, wallCount, grid->wallStart, grid->obstacleStart[cells]);
+}
+
+void SimGridBuild(SimGrid *grid, const Obstacle *obstacles, int obstacleCount, const DeadlyWall *walls,
+                  int wallCount, float screenWidth, float screenHeight, float coreRadius) {
+    GridShape obstacleShapes[NUM_OBSTACLES];
+    GridShape wallShapes[MAX_DEADLY_WALLS];
+    bool obstacleUsed[NUM_OBSTACLES];
+    bool wallUsed[MAX_DEADLY_WALLS];
+
+    if (walls == NULL) wallCount = 0;
+
+    // Engeller: çember çarpışması ve lazerde SimLaserInReach sınırı
+    for (int i = 0; i < obstacleCount; i++) {
+        const Obstacle *obstacle = &obstacles[i];
+        double reach = obstacle->radius + coreRadius;
+
+        if (obstacle->type == OBSTACLE_LASER) {
+            reach = GridMax(reach, LASER_LENGTH + 2.0 * SimLaserThreshold(coreRadius) + 1.0);
+        }
+
+        obstacleUsed[i] = obstacle->active;
+        obstacleShapes[i] = (GridShape){ obstacle->position.x, obstacle->position.y,
+                                         obstacle->position.x, obstacle->position.y, reach + GRID_MARGIN };
+    }
+
+    // Duvarlar: SimPointNearLine baskın eksen boyunca parçanın içinde ve dik
+    // uzaklıkta eşikten yakın noktaları kabul eder; bunlar parçaya en fazla
+    // eşik * sqrt(2) uzaklıktadır
+    for (int i = 0; i < wallCount; i++) {
+        const DeadlyWall *wall = &walls[i];
+        double reach = 1.5 * SimWallThreshold(wall->thickness, coreRadius);
+
+        wallUsed[i] = wall->active;
+        wallShapes[i] = (GridShape){ wall->startPos.x, wall->startPos.y,
+                                     wall->endPos.x, wall->endPos.y, reach + GRID_MARGIN };
+    }
+
+    // Hücre boyu ekran SIM_GRID_MAX_COLS x SIM_GRID_MAX_ROWS hücreye sığacak kadar büyütülür
+    double cellSize = GridMax(SIM_GRID_MIN_CELL_SIZE,
+                              GridMax(screenWidth / SIM_GRID_MAX_COLS, screenHeight / SIM_GRID_MAX_ROWS));
+
+    // Adaylar sığmazsa hücreler iki kat büyütülür. Tek hücrede her engel ve duvar
+    // bir kez yazılır (yukarıdaki _Static_assert), bu yüzden döngü her zaman biter.
+    for (;;) {
+        memset(grid, 0, sizeof(*grid));
+        grid->cols = (int)GridMin(GridMax(ceil(screenWidth / cellSize), 1.0), SIM_GRID_MAX_COLS);
+        grid->rows = (int)GridMin(GridMax(ceil(screenHeight / cellSize), 1.0), SIM_GRID_MAX_ROWS);
+        grid->inverseCellSize = (float)(1.0 / cellSize);
+
+        if (GridFill(grid, cellSize, obstacleShapes, obstacleUsed, obstacleCount, wallShapes, wallUsed, wallCount)) {
+            return;
+        }
+        cellSize *= 2.0;
+    }
+}
@@ -0,0 +1,54 @@
+#ifndef FLAMING_GRID_H
+#define FLAMING_GRID_H
+
+// Engel ve duvar çarpışmaları için düzgün ızgara (uniform grid).
+//
+// Engeller ve duvarlar level boyunca yer değiştirmez, bu yüzden ızgara level
+// kurulurken bir kez oluşturulur. Her hücre, beyaz topun merkezi o hücredeyken
+// topa değebilecek engel ve duvarların indekslerini artan sırada tutar. SimStep
+// her tick'te yalnızca topun hücresindeki adayları test eder.
+//
+// Bir engel, etki alanının (çember + top yarıçapı; lazerde SimLaserInReach
+// sınırı) değdiği her hücreye, bir duvar ise eşiğiyle genişletilmiş doğru
+// parçasının değdiği hücrelere yazılır. Sürekli çarpışmada (flaming_ccd.h) tick
+// boyunca süpürülen bölge tek hücreye sığmıyorsa tüm adaylar denenir. Izgara dışındaki konumlar kenar
+// hücrelerine sıkıştırılır; kenar hücreleri de dışarıya doğru uzatılmış sayılır.
+// Adaylar SIM_GRID_MAX_ENTRIES'e sığmazsa hücreler sığana kadar büyütülür.
+
+#include "flaming_sim.h"
+
+// === Fonksiyon prototipleri ===
+// walls NULL olabilir; pasif duvarlar ızgaraya yazılmaz
+void SimGridBuild(SimGrid *grid, const Obstacle *obstacles, int obstacleCount, const DeadlyWall *walls,
+                  int wallCount, float screenWidth, float screenHeight, float coreRadius);
+
+// === Sorgular ===
+static inline int SimGridCell(const SimGrid *grid, Vector2 point) {
+    float x = point.x * grid->inverseCellSize;
+    float y = point.y * grid->inverseCellSize;
+    int col = (x >= 0.0f) ? ((x < grid->cols) ? (int)x : grid->cols - 1) : 0;
+    int row = (y >= 0.0f) ? ((y < grid->rows) ? (int)y : grid->rows - 1) : 0;
+    return row * grid->cols + col;
+}
+
+// point'in reach kadar çevresi (kare) tek hücredeyse o hücre, değilse -1.
+// Tick boyunca süpürülen top bu karenin dışına çıkamaz (sekmeler hızın
+// büyüklüğünü korur), bu yüzden hücrenin adayları süpürme için de yeterlidir.
+static inline int SimGridSweepCell(const SimGrid *grid, Vector2 point, float reach) {
+    int cell = SimGridCell(grid, (Vector2){ point.x - reach, point.y - reach });
+    if (SimGridCell(grid, (Vector2){ point.x + reach, point.y + reach }) != cell) return -1;
+    return cell;
+}
+
+// Hücredeki aday listeleri: [*first, *last)
+static inline void SimGridObstacles(const SimGrid *grid, int cell, const uint16_t **first, const uint16_t **last) {
+    *first = grid->entries + grid->obstacleStart[cell];
+    *last = grid->entries + grid->obstacleStart[cell + 1];
+}
+
+static inline void SimGridWalls(const SimGrid *grid, int cell, const uint16_t **first, const uint16_t **last) {
+    *first = grid->entries + grid->wallStart[cell];
+    *last = grid->entries + grid->wallStart[cell + 1];
+}
+
+#endif // FLAMING_GRID_H
@@ -0,0 +1,308 @@
+// Flaming Core ekransız simülasyon aracı
+// Pencere ve ses cihazı açmadan flaming_sim.c'yi çalıştırır.
+//
+// Derleme: gcc -O2 flaming_headless.c flaming_sim.c flaming_event.c flaming_ccd.c flaming_grid.c flaming_batch.c flaming_simd.c flaming_pool.c flaming_replay.c flaming_sdf.c -o flaming_headless -lm -lpthread
+// Kullanım: ./flaming_headless [level 1-5] [koşu sayısı] [seed] [thread sayısı]
+//           ./flaming_headless --verify <kayıt.rpl> [beklenen hash]
+//
+// Thread sayısı verilirse koşular toplu motorda (flaming_batch.c) aynı anda
+// ve iş havuzuyla (flaming_pool.c) paralel ilerletilir; 0 tüm çekirdekleri kullanır.
+//
+// --verify bir kaydı beklemeden sonuna kadar simüle eder ve sonucu, bitiş
+// tick'ini ve son durumun hash'ini yazar. Beklenen hash verilip tutmazsa çıkış
+// kodu 2'dir; regresyon testleri ve bestTimes doğrulaması bunu kullanır.
+//
+// Tek thread'li koşular ve --verify dünyayı SimAdvance (flaming_event.h) ile
+// ilerletir: girdinin değişmediği tick'lerde olaysız aralıklar atlanır, sonuç
+// ve hash tick tick SimStep ile aynıdır.
+
+#include "flaming_sim.h"
+#include "flaming_batch.h"
+#include "flaming_event.h"
+#include "flaming_pool.h"
+#include "flaming_replay.h"
+#include "flaming_sdf.h"
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define HEADLESS_SCREEN_WIDTH 1470
+#define HEADLESS_SCREEN_HEIGHT 818
+#define HEADLESS_MAX_SECONDS 120.0f
+
+// Basit bot: her 1.5 saniyede bir hedefe nişan alıp bir tick sonra bırakır
+#define BOT_PERIOD (SIM_TICK_RATE * 3 / 2)
+
+// Botun girdisi tick'ten sonraki kaç tick boyunca aynı kalır
+static int BotQuietTicks(int tick) {
+    int phase = tick % BOT_PERIOD;
+    return (phase < 2) ? 1 : BOT_PERIOD - phase;
+}
+
+static void BotAim(int tick, Vector2 target, SimRng *botRng, SimInput *input) {
+    int phase = tick % BOT_PERIOD;
+    if (phase == 0) {
+        input->aimDown = true;
+        input->aimTarget = target;
+        input->aimTarget.x += (float)SimRngRange(botRng, -20, 20);
+        input->aimTarget.y += (float)SimRngRange(botRng, -20, 20);
+    }
+    else if (phase == 1) {
+        input->aimReleased = true;
+    }
+}
+
+// Engele giden düz yol bir duvara değmeden varıyor mu (uzaklık alanında ışın yürütme)
+static bool BotPathClear(const SimSdf *sdf, Vector2 from, Vector2 to) {
+    if (sdf == NULL) return true;
+
+    float dx = to.x - from.x;
+    float dy = to.y - from.y;
+    float length = sqrtf(dx * dx + dy * dy);
+    if (length <= 0.0f) return true;
+
+    Vector2 direction = { dx / length, dy / length };
+    float reach = length - sdf->coreRadius;
+    return SimSdfRayMarch(sdf, from, direction, sdf->coreReach - 1.0f, reach) >= reach;
+}
+
+// Hedef: yolu duvarla kesilmeyen en yakın aktif engel; yoksa en yakın aktif engel
+static void BotInput(const GameWorld *world, int tick, SimRng *botRng, SimInput *input) {
+    const SimSdf *sdf = SimWorldSdf(world);
+    float bestDistance = 0.0f;
+    bool bestClear = false;
+    int target = -1;
+
+    *input = (SimInput){ 0 };
+
+    for (int k = 0; k < world->aliveObstacles; k++) {
+        int i = world->obstacleOrder[k];
+        const Obstacle *obstacle = &world->obstacles[i];
+
+        float dx = obstacle->position.x - world->corePosition.x;
+        float dy = obstacle->position.y - world->corePosition.y;
+        float distance = dx * dx + dy * dy;
+        bool clear = BotPathClear(sdf, world->corePosition, obstacle->position);
+        if (target < 0 || (clear && !bestClear) || (clear == bestClear && distance < bestDistance)) {
+            bestClear = clear;
+            bestDistance = distance;
+            target = i;
+        }
+    }
+
+    if (target < 0) return;
+    BotAim(tick, world->obstacles[target].position, botRng, input);
+}
+
+// Toplu motor için aynı bot; user her dünyanın bot üretecini tutar
+static void BatchBotInput(const SimBatch *batch, int index, SimInput *input, void *user) {
+    SimRng *botRng = &((SimRng *)user)[index];
+    const SimSdf *sdf = batch->sdf[batch->level[index]];
+    Vector2 core = { batch->coreX[index], batch->coreY[index] };
+    float bestDistance = 0.0f;
+    bool bestClear = false;
+    int target = -1;
+
+    *input = (SimInput){ 0 };
+
+    const Obstacle *obstacles = batch->obstacles + index * NUM_OBSTACLES;
+    const uint16_t *order = batch->obstacleOrder + index * NUM_OBSTACLES;
+    for (int k = 0; k < batch->aliveObstacles[index]; k++) {
+        int o = order[k];
+
+        float dx = obstacles[o].position.x - core.x;
+        float dy = obstacles[o].position.y - core.y;
+        float distance = dx * dx + dy * dy;
+        bool clear = BotPathClear(sdf, core, obstacles[o].position);
+        if (target < 0 || (clear && !bestClear) || (clear == bestClear && distance < bestDistance)) {
+            bestClear = clear;
+            bestDistance = distance;
+            target = o;
+        }
+    }
+
+    if (target < 0) return;
+    BotAim(batch->tick[index], obstacles[target].position, botRng, input);
+}
+
+static double HeadlessSeconds(void) {
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    return (double)now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+// Tüm koşuları tek batch'te, iş havuzuyla paralel oynatır
+static bool RunBatch(int level, int runs, uint64_t seed, int threads,
+                     int *victories, int *defeats, long long *totalTicks) {
+    SimBatch batch;
+    SimPool pool;
+    SimRng *botRngs = malloc((size_t)runs * sizeof(SimRng));
+    GameWorld *world = malloc(sizeof(GameWorld));
+
+    if (botRngs == NULL || world == NULL || !SimBatchCreate(&batch, runs, HEADLESS_SCREEN_WIDTH, HEADLESS_SCREEN_HEIGHT)) {
+        free(botRngs);
+        free(world);
+        return false;
+    }
+    if (!SimPoolCreate(&pool, threads, true)) {
+        SimBatchDestroy(&batch);
+        free(botRngs);
+        free(world);
+        return false;
+    }
+
+    bool loaded = true;
+    for (int run = 0; run < runs && loaded; run++) {
+        SimInitWorld(world, level, HEADLESS_SCREEN_WIDTH, HEADLESS_SCREEN_HEIGHT, seed + run);
+        loaded = SimBatchLoadWorld(&batch, run, world);
+        SimRngSeed(&botRngs[run], seed + run, 0);
+    }
+
+    int maxTicks = (int)(HEADLESS_MAX_SECONDS * SIM_TICK_RATE);
+    int active = loaded ? runs : 0;
+    for (int tick = 0; tick < maxTicks && active > 0; tick++) {
+        *totalTicks += active;
+        active = SimPoolStep(&pool, &batch, NULL, BatchBotInput, botRngs, SIM_DT);
+    }
+
+    for (int run = 0; run < runs; run++) {
+        if (batch.flags[run] & BATCH_FLAG_VICTORY) (*victories)++;
+        else if (batch.flags[run] & BATCH_FLAG_GAME_OVER) (*defeats)++;
+    }
+
+    SimPoolDestroy(&pool);
+    SimBatchDestroy(&batch);
+    free(botRngs);
+    free(world);
+    return loaded;
+}
+
+// Kaydı ekransız yeniden oynatır; dönüş değeri çıkış kodudur
+static int VerifyReplay(const char *fileName, const char *expectedHash) {
+    Replay replay;
+    ReplayPlayer player;
+    SimInput input;
+    GameWorld *world = malloc(sizeof(GameWorld));
+    int endTick = -1;  // Level bittiği ya da beyaz top yandığı tick
+
+    if (world == NULL || !ReplayLoad(&replay, fileName)) {
+        fprintf(stderr, "Kayıt okunamadı: %s\n", fileName);
+        free(world);
+        return 1;
+    }
+
+    double start = HeadlessSeconds();
+
+    ReplayInitWorld(&replay, world);
+    ReplayPlayerInit(&player, &replay);
+    float dt = 1.0f / replay.header.tickRate;
+
+    uint32_t run;
+    while ((run = ReplayPlayerNextRun(&player, &input, NULL)) > 0) {
+        for (int left = (int)run; left > 0;) {
+            unsigned int events;
+            left -= SimAdvance(world, &input, dt, left, &events);
+            if (endTick < 0 && (events & (SIM_EVENT_LEVEL_COMPLETED | SIM_EVENT_CORE_DESTROYED))) {
+                endTick = world->tick;
+            }
+        }
+    }
+
+    double seconds = HeadlessSeconds() - start;
+    uint64_t hash = SimWorldHash(world);
+    double simulatedSeconds = (double)player.tick / replay.header.tickRate;
+
+    printf("replay: %s\n", fileName);
+    printf("level: %d (seed %" PRIu64 ", %d Hz)\n", replay.header.level + 1, replay.header.seed, replay.header.tickRate);
+    printf("ticks: %" PRIu32 " / %" PRIu32 "\n", player.tick, replay.header.tickCount);
+    printf("outcome: %s\n", world->victory ? "victory" : (world->gameOver ? "gameover" : "unfinished"));
+    printf("end tick: %d\n", endTick);
+    if (world->victory) printf("completion time: %.3f s\n", world->completionTime);
+    printf("hash: %016" PRIx64 "\n", hash);
+    printf("time: %.3f ms (%.0fx real time)\n", seconds * 1000.0,
+           seconds > 0 ? simulatedSeconds / seconds : 0.0);
+
+    int status = 0;
+    if (player.tick != replay.header.tickCount) {
+        fprintf(stderr, "Kayıt eksik ya da bozuk\n");
+        status = 1;
+    }
+    else if (expectedHash != NULL && strtoull(expectedHash, NULL, 16) != hash) {
+        fprintf(stderr, "Hash tutmuyor: beklenen %s\n", expectedHash);
+        status = 2;
+    }
+
+    ReplayFree(&replay);
+    free(world);
+    return status;
+}
+
+int main(int argc, char **argv) {
+    if (argc > 2 && strcmp(argv[1], "--verify") == 0) {
+        return VerifyReplay(argv[2], (argc > 3) ? argv[3] : NULL);
+    }
+
+    int level = (argc > 1) ? atoi(argv[1]) - 1 : 0;
+    int runs = (argc > 2) ? atoi(argv[2]) : 1000;
+    uint64_t seed = (argc > 3) ? strtoull(argv[3], NULL, 10) : 1u;
+    int threads = (argc > 4) ? atoi(argv[4]) : -1;
+
+    if (level < 0 || level >= MAX_LEVELS || runs <= 0) {
+        fprintf(stderr, "Kullanım: %s [level 1-%d] [koşu sayısı] [seed] [thread sayısı]\n", argv[0], MAX_LEVELS);
+        return 1;
+    }
+
+    int victories = 0;
+    int defeats = 0;
+    long long totalTicks = 0;
+
+    double start = HeadlessSeconds();
+
+    if (threads >= 0) {
+        if (!RunBatch(level, runs, seed, threads, &victories, &defeats, &totalTicks)) {
+            fprintf(stderr, "Toplu simülasyon başlatılamadı\n");
+            return 1;
+        }
+    }
+    else {
+        GameWorld world;
+
+        for (int run = 0; run < runs; run++) {
+            SimRng botRng;
+            SimInitWorld(&world, level, HEADLESS_SCREEN_WIDTH, HEADLESS_SCREEN_HEIGHT, seed + run);
+            SimRngSeed(&botRng, seed + run, 0);
+
+            for (int tick = 0; world.levelTime < HEADLESS_MAX_SECONDS;) {
+                SimInput input;
+                BotInput(&world, tick, &botRng, &input);
+
+                // Süre sınırı tick tick denetlenir; son tick'lere yaklaşınca tek adım
+                int ticks = BotQuietTicks(tick);
+                int limit = (int)((HEADLESS_MAX_SECONDS - world.levelTime) / SIM_DT) - 1;
+                if (ticks > limit) ticks = (limit > 1) ? limit : 1;
+
+                int advanced = SimAdvance(&world, &input, SIM_DT, ticks, NULL);
+                tick += advanced;
+                totalTicks += advanced;
+
+                if (world.victory || (world.gameOver && !world.explosionActive)) break;
+            }
+
+            if (world.victory) victories++;
+            else if (world.gameOver) defeats++;
+        }
+    }
+
+    double seconds = HeadlessSeconds() - start;
+
+    printf("level: %d\n", level + 1);
+    printf("runs: %d (victory %d, gameover %d, timeout %d)\n", runs, victories, defeats, runs - victories - defeats);
+    printf("ticks: %lld\n", totalTicks);
+    printf("time: %.3f s (%.0f runs/s, %.0f ticks/s)\n", seconds,
+           seconds > 0 ? runs / seconds : 0.0, seconds > 0 ? totalTicks / seconds : 0.0);
+
+    return 0;
+}
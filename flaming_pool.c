@@ -0,0 +1,170 @@
+#include "flaming_pool.h"
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// === Dünya aralığını ilerletme ===
+static int PoolStepRange(SimPool *pool, int first, int last) {
+    SimBatch *batch = pool->batch;
+    int active = 0;
+
+    for (int w = first; w < last; w++) {
+        if (batch->flags[w] & BATCH_FLAG_DONE) continue;
+
+        if (pool->inputFn != NULL) {
+            SimInput input = { 0 };
+            pool->inputFn(batch, w, &input, pool->user);
+            SimStepBatchWorld(batch, w, &input, pool->dt);
+        }
+        else {
+            SimStepBatchWorld(batch, w, pool->inputs != NULL ? &pool->inputs[w] : NULL, pool->dt);
+        }
+
+        if (!(batch->flags[w] & BATCH_FLAG_DONE)) active++;
+    }
+
+    return active;
+}
+
+// Bir thread'in bu tick'teki payı
+static void PoolRunShare(SimPool *pool, int workerIndex) {
+    int count = pool->batch->count;
+    int active = 0;
+
+    if (pool->workStealing) {
+        // Boşta kalan thread sıradaki parçayı alır
+        for (;;) {
+            int first = atomic_fetch_add_explicit(&pool->nextChunk, 1, memory_order_relaxed) * SIM_POOL_CHUNK;
+            if (first >= count) break;
+
+            int last = (first + SIM_POOL_CHUNK < count) ? first + SIM_POOL_CHUNK : count;
+            active += PoolStepRange(pool, first, last);
+        }
+    }
+    else {
+        // Sabit bölüşüm: her thread'e bitişik bir aralık
+        int first = (int)((long long)count * workerIndex / pool->threadCount);
+        int last = (int)((long long)count * (workerIndex + 1) / pool->threadCount);
+        active = PoolStepRange(pool, first, last);
+    }
+
+    atomic_fetch_add_explicit(&pool->activeWorlds, active, memory_order_relaxed);
+}
+
+static void *PoolWorkerMain(void *arg) {
+    SimPoolWorker *worker = arg;
+    SimPool *pool = worker->pool;
+    unsigned int seenGeneration = 0;
+
+    for (;;) {
+        pthread_mutex_lock(&pool->mutex);
+        while (pool->generation == seenGeneration && !pool->quit) {
+            pthread_cond_wait(&pool->startCond, &pool->mutex);
+        }
+        if (pool->quit) {
+            pthread_mutex_unlock(&pool->mutex);
+            break;
+        }
+        seenGeneration = pool->generation;
+        pthread_mutex_unlock(&pool->mutex);
+
+        PoolRunShare(pool, worker->index);
+
+        // Bariyer: son biten thread çağıranı uyandırır
+        pthread_mutex_lock(&pool->mutex);
+        if (--pool->pending == 0) pthread_cond_signal(&pool->doneCond);
+        pthread_mutex_unlock(&pool->mutex);
+    }
+
+    return NULL;
+}
+
+// === Havuz yönetimi ===
+bool SimPoolCreate(SimPool *pool, int threadCount, bool workStealing) {
+    memset(pool, 0, sizeof(*pool));
+
+    if (threadCount <= 0) {
+        long cores = sysconf(_SC_NPROCESSORS_ONLN);
+        threadCount = (cores > 0) ? (int)cores : 1;
+    }
+
+    pool->threadCount = threadCount;
+    pool->workStealing = workStealing;
+    atomic_init(&pool->nextChunk, 0);
+    atomic_init(&pool->activeWorlds, 0);
+
+    pthread_mutex_init(&pool->mutex, NULL);
+    pthread_cond_init(&pool->startCond, NULL);
+    pthread_cond_init(&pool->doneCond, NULL);
+
+    // 0. işçi çağıran thread'dir; yalnızca yardımcılar için thread açılır
+    pool->workers = calloc((size_t)threadCount, sizeof(SimPoolWorker));
+    if (pool->workers == NULL) {
+        SimPoolDestroy(pool);
+        return false;
+    }
+
+    for (int i = 0; i < threadCount; i++) {
+        pool->workers[i].pool = pool;
+        pool->workers[i].index = i;
+    }
+
+    for (int i = 1; i < threadCount; i++) {
+        if (pthread_create(&pool->workers[i].thread, NULL, PoolWorkerMain, &pool->workers[i]) != 0) {
+            pool->threadCount = i;  // Yalnızca açılabilenler kapatılsın
+            SimPoolDestroy(pool);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void SimPoolDestroy(SimPool *pool) {
+    if (pool->workers != NULL) {
+        pthread_mutex_lock(&pool->mutex);
+        pool->quit = true;
+        pthread_cond_broadcast(&pool->startCond);
+        pthread_mutex_unlock(&pool->mutex);
+
+        for (int i = 1; i < pool->threadCount; i++) {
+            pthread_join(pool->workers[i].thread, NULL);
+        }
+        free(pool->workers);
+    }
+
+    pthread_cond_destroy(&pool->doneCond);
+    pthread_cond_destroy(&pool->startCond);
+    pthread_mutex_destroy(&pool->mutex);
+
+    memset(pool, 0, sizeof(*pool));
+}
+
+// === Tick ===
+int SimPoolStep(SimPool *pool, SimBatch *batch, const SimInput *inputs,
+                SimPoolInputFn inputFn, void *user, float dt) {
+    pool->batch = batch;
+    pool->inputs = inputs;
+    pool->inputFn = inputFn;
+    pool->user = user;
+    pool->dt = dt;
+    atomic_store_explicit(&pool->nextChunk, 0, memory_order_relaxed);
+    atomic_store_explicit(&pool->activeWorlds, 0, memory_order_relaxed);
+
+    // İş alanları mutex ile yayınlanır; yardımcılar onları kilidi aldıktan sonra okur
+    pthread_mutex_lock(&pool->mutex);
+    pool->pending = pool->threadCount - 1;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->startCond);
+    pthread_mutex_unlock(&pool->mutex);
+
+    PoolRunShare(pool, 0);
+
+    pthread_mutex_lock(&pool->mutex);
+    while (pool->pending > 0) {
+        pthread_cond_wait(&pool->doneCond, &pool->mutex);
+    }
+    pthread_mutex_unlock(&pool->mutex);
+
+    return atomic_load_explicit(&pool->activeWorlds, memory_order_relaxed);
+}
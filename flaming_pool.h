@@ -0,0 +1,63 @@
+#ifndef FLAMING_POOL_H
+#define FLAMING_POOL_H
+
+// Toplu simülasyonu (flaming_batch.h) birden çok çekirdekte ilerleten iş havuzu.
+// Dünyalar birbirinden bağımsız olduğu için thread'ler arasında paylaşılan
+// değişken durum yoktur: her dünyayı bir tick içinde yalnızca bir thread
+// ilerletir. SimPoolStep her tick sonunda tüm thread'leri bekler (bariyer),
+// böylece çağıran taraf tick'ler arasında batch'i güvenle okuyabilir.
+//
+// workStealing açıkken dünyalar SIM_POOL_CHUNK'lık parçalara bölünür ve boşta
+// kalan thread ortak sayaçtan sıradaki parçayı alır; oyunu erken biten
+// dünyaların bıraktığı boşluk böylece diğer thread'lerce doldurulur. Kapalıyken
+// her thread'in sabit, bitişik bir dünya aralığı vardır.
+
+#include "flaming_batch.h"
+#include <pthread.h>
+#include <stdatomic.h>
+
+#define SIM_POOL_CHUNK 64  // Bir parçadaki dünya sayısı
+
+// Bir dünyanın bu tick'teki girdisini üretir; yalnızca o dünyanın verisini okumalı
+typedef void (*SimPoolInputFn)(const SimBatch *batch, int index, SimInput *input, void *user);
+
+typedef struct SimPool SimPool;
+
+typedef struct {
+    SimPool *pool;
+    int index;
+    pthread_t thread;
+} SimPoolWorker;
+
+struct SimPool {
+    int threadCount;  // Çağıran thread dahil
+    bool workStealing;
+    SimPoolWorker *workers;
+
+    pthread_mutex_t mutex;
+    pthread_cond_t startCond;
+    pthread_cond_t doneCond;
+    unsigned int generation;  // Her tick'te artar; yardımcı thread'leri uyandırır
+    int pending;              // İşini bitirmemiş yardımcı thread sayısı
+    bool quit;
+
+    // Geçerli tick'in işi
+    SimBatch *batch;
+    const SimInput *inputs;
+    SimPoolInputFn inputFn;
+    void *user;
+    float dt;
+    atomic_int nextChunk;
+    atomic_int activeWorlds;
+};
+
+// === Fonksiyon prototipleri ===
+bool SimPoolCreate(SimPool *pool, int threadCount, bool workStealing);  // threadCount <= 0: tüm çekirdekler
+void SimPoolDestroy(SimPool *pool);
+
+// Tüm dünyaları bir tick ilerletir ve oyunu sürmekte olan dünya sayısını döndürür.
+// Girdi inputFn'den (verildiyse), yoksa inputs dizisinden (count adet ya da NULL) gelir.
+int SimPoolStep(SimPool *pool, SimBatch *batch, const SimInput *inputs,
+                SimPoolInputFn inputFn, void *user, float dt);
+
+#endif // FLAMING_POOL_H
@@ -0,0 +1,359 @@
+#include "flaming_replay.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// === Bayt yazma/okuma (little-endian) ===
+static bool ReplayReserve(Replay *replay, size_t extra) {
+    if (replay->failed) return false;
+    if (replay->size + extra <= replay->capacity) return true;
+
+    size_t capacity = (replay->capacity > 0) ? replay->capacity : 256;
+    while (capacity < replay->size + extra) capacity *= 2;
+
+    unsigned char *data = realloc(replay->data, capacity);
+    if (data == NULL) {
+        replay->failed = true;
+        return false;
+    }
+
+    replay->data = data;
+    replay->capacity = capacity;
+    return true;
+}
+
+static void PutU16(unsigned char *out, uint16_t value) {
+    out[0] = (unsigned char)value;
+    out[1] = (unsigned char)(value >> 8);
+}
+
+static void PutU32(unsigned char *out, uint32_t value) {
+    for (int i = 0; i < 4; i++) out[i] = (unsigned char)(value >> (8 * i));
+}
+
+static void PutU64(unsigned char *out, uint64_t value) {
+    for (int i = 0; i < 8; i++) out[i] = (unsigned char)(value >> (8 * i));
+}
+
+static uint16_t GetU16(const unsigned char *in) {
+    return (uint16_t)(in[0] | (in[1] << 8));
+}
+
+static uint32_t GetU32(const unsigned char *in) {
+    uint32_t value = 0;
+    for (int i = 0; i < 4; i++) value |= (uint32_t)in[i] << (8 * i);
+    return value;
+}
+
+static uint64_t GetU64(const unsigned char *in) {
+    uint64_t value = 0;
+    for (int i = 0; i < 8; i++) value |= (uint64_t)in[i] << (8 * i);
+    return value;
+}
+
+static uint32_t FloatBits(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static float BitsFloat(uint32_t bits) {
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// offset'teki kaydı okur; target yalnızca kayıtta varsa değişir
+static bool ReplayReadRecord(const Replay *replay, size_t *offset, uint8_t *flags, Vector2 *target,
+                             uint32_t *length) {
+    const unsigned char *in = replay->data + *offset;
+    const unsigned char *end = replay->data + replay->size;
+
+    if (in >= end) return false;
+    *flags = *in++;
+
+    if (*flags & REPLAY_TARGET) {
+        if (end - in < 8) return false;
+        target->x = BitsFloat(GetU32(in));
+        target->y = BitsFloat(GetU32(in + 4));
+        in += 8;
+    }
+
+    // Beşinci baytın üst bitleri 32 bite sığmaz; UINT32_MAX tekrar da uzunluğu
+    // 0'a sardırır. İkisi de başlık aralıkları gibi reddedilir.
+    uint32_t repeat = 0;
+    if (*flags & REPLAY_REPEAT) {
+        for (int shift = 0; ; shift += 7) {
+            if (in >= end || shift > 28) return false;
+            if (shift == 28 && (*in & 0x70) != 0) return false;
+            repeat |= (uint32_t)(*in & 0x7F) << shift;
+            if (!(*in++ & 0x80)) break;
+        }
+        if (repeat == UINT32_MAX) return false;
+    }
+
+    *length = repeat + 1;
+    *offset = (size_t)(in - replay->data);
+    return true;
+}
+
+// === Kayıt ===
+void ReplayBeginRecording(Replay *replay, int level, uint64_t seed, int tickRate, int screenWidth, int screenHeight) {
+    unsigned char *data = replay->data;
+    size_t capacity = replay->capacity;
+
+    // Önceki kaydın tamponu yeniden kullanılır
+    memset(replay, 0, sizeof(*replay));
+    replay->data = data;
+    replay->capacity = capacity;
+
+    replay->header.version = REPLAY_VERSION;
+    replay->header.level = level;
+    replay->header.seed = seed;
+    replay->header.tickRate = tickRate;
+    replay->header.screenWidth = screenWidth;
+    replay->header.screenHeight = screenHeight;
+}
+
+// Bekleyen tekrar grubunu tampona yazar
+static void ReplayFlushRun(Replay *replay) {
+    if (replay->runLength == 0) return;
+    if (!ReplayReserve(replay, 1 + 8 + 5)) return;
+
+    unsigned char *out = replay->data + replay->size;
+    uint32_t repeat = replay->runLength - 1;
+    uint8_t flags = replay->runFlags;
+
+    if (replay->runHasTarget) flags |= REPLAY_TARGET;
+    if (repeat > 0) flags |= REPLAY_REPEAT;
+    *out++ = flags;
+
+    if (replay->runHasTarget) {
+        PutU32(out, FloatBits(replay->lastTarget.x));
+        PutU32(out + 4, FloatBits(replay->lastTarget.y));
+        out += 8;
+    }
+
+    if (repeat > 0) {
+        while (repeat >= 0x80) {
+            *out++ = (unsigned char)(repeat | 0x80);
+            repeat >>= 7;
+        }
+        *out++ = (unsigned char)repeat;
+    }
+
+    replay->size = (size_t)(out - replay->data);
+    replay->runLength = 0;
+}
+
+bool ReplayRecordTick(Replay *replay, const SimInput *input) {
+    uint8_t flags = (input->aimDown ? REPLAY_AIM_DOWN : 0) |
+                    (input->aimReleased ? REPLAY_AIM_RELEASED : 0) |
+                    (input->toggleBulletTime ? REPLAY_TOGGLE_BULLET : 0) |
+                    (input->resumeFromPause ? REPLAY_RESUME : 0) |
+                    (replay->pausePending ? REPLAY_PAUSED : 0);
+
+    // Nişan noktası yalnızca SimStep onu okuduğunda ve değiştiğinde yazılır
+    bool needTarget = input->aimDown &&
+                      (!replay->hasTarget ||
+                       FloatBits(input->aimTarget.x) != FloatBits(replay->lastTarget.x) ||
+                       FloatBits(input->aimTarget.y) != FloatBits(replay->lastTarget.y));
+
+    // Okuyucu UINT32_MAX tekrarı reddettiğinden en uzun grup burada bölünür
+    if (needTarget || replay->runLength == 0 || replay->runLength == UINT32_MAX || flags != replay->runFlags) {
+        ReplayFlushRun(replay);
+
+        replay->runFlags = flags;
+        replay->runHasTarget = needTarget;
+        if (needTarget) {
+            replay->lastTarget = input->aimTarget;
+            replay->hasTarget = true;
+        }
+    }
+
+    replay->runLength++;
+    replay->header.tickCount++;
+    replay->pausePending = false;
+
+    return !replay->failed;
+}
+
+// Geri sarmadan sonra kaydı dünyanın tick'ine kısaltır; kayıt buradan devam eder
+void ReplayTruncate(Replay *replay, uint32_t tickCount) {
+    ReplayFlushRun(replay);
+    if (replay->failed || tickCount >= replay->header.tickCount) return;
+
+    size_t offset = 0;
+    uint32_t ticks = 0;
+    Vector2 target = { 0 };
+
+    replay->hasTarget = false;
+
+    while (ticks < tickCount) {
+        size_t recordStart = offset;
+        uint8_t flags;
+        uint32_t length;
+
+        if (!ReplayReadRecord(replay, &offset, &flags, &target, &length)) {
+            replay->failed = true;
+            return;
+        }
+        if (flags & REPLAY_TARGET) {
+            replay->lastTarget = target;
+            replay->hasTarget = true;
+        }
+
+        // Kesim bu kaydın içindeyse kayıt kısaltılıp bekleyen grup olarak geri alınır
+        if (ticks + length > tickCount) {
+            replay->runFlags = flags & REPLAY_INPUT_MASK;
+            replay->runHasTarget = (flags & REPLAY_TARGET) != 0;
+            replay->runLength = tickCount - ticks;
+            offset = recordStart;
+            break;
+        }
+        ticks += length;
+    }
+
+    replay->size = offset;
+    replay->header.tickCount = tickCount;
+    replay->pausePending = false;
+}
+
+void ReplayRecordPause(Replay *replay) {
+    replay->pausePending = true;
+}
+
+bool ReplayFinishRecording(Replay *replay) {
+    ReplayFlushRun(replay);
+    return !replay->failed;
+}
+
+void ReplayFree(Replay *replay) {
+    free(replay->data);
+    memset(replay, 0, sizeof(*replay));
+}
+
+// === Dosya ===
+bool ReplaySave(const Replay *replay, const char *fileName) {
+    unsigned char header[REPLAY_HEADER_SIZE] = { 0 };
+
+    if (replay->failed || replay->runLength > 0) return false;  // Önce ReplayFinishRecording
+
+    memcpy(header, REPLAY_MAGIC, 4);
+    PutU16(header + 4, (uint16_t)replay->header.version);
+    header[6] = (unsigned char)replay->header.level;
+    PutU64(header + 8, replay->header.seed);
+    PutU16(header + 16, (uint16_t)replay->header.tickRate);
+    PutU16(header + 18, (uint16_t)replay->header.screenWidth);
+    PutU16(header + 20, (uint16_t)replay->header.screenHeight);
+    PutU32(header + 22, replay->header.tickCount);
+
+    FILE *file = fopen(fileName, "wb");
+    if (file == NULL) return false;
+
+    bool ok = fwrite(header, 1, sizeof(header), file) == sizeof(header) &&
+              (replay->size == 0 || fwrite(replay->data, 1, replay->size, file) == replay->size);
+
+    return (fclose(file) == 0) && ok;
+}
+
+bool ReplayLoad(Replay *replay, const char *fileName) {
+    unsigned char header[REPLAY_HEADER_SIZE];
+
+    memset(replay, 0, sizeof(*replay));
+
+    FILE *file = fopen(fileName, "rb");
+    if (file == NULL) return false;
+
+    if (fread(header, 1, sizeof(header), file) != sizeof(header) || memcmp(header, REPLAY_MAGIC, 4) != 0) {
+        fclose(file);
+        return false;
+    }
+
+    replay->header.version = GetU16(header + 4);
+    replay->header.level = header[6];
+    replay->header.seed = GetU64(header + 8);
+    replay->header.tickRate = GetU16(header + 16);
+    replay->header.screenWidth = GetU16(header + 18);
+    replay->header.screenHeight = GetU16(header + 20);
+    replay->header.tickCount = GetU32(header + 22);
+
+    // Başlık dünyayı doğrudan kurar; boyutlar ve tick hızı makul aralıkta olmalı
+    if (replay->header.version != REPLAY_VERSION || replay->header.level >= MAX_LEVELS ||
+        replay->header.tickRate <= 0 || replay->header.tickRate > REPLAY_MAX_TICK_RATE ||
+        replay->header.screenWidth <= 0 || replay->header.screenWidth > REPLAY_MAX_SCREEN_SIZE ||
+        replay->header.screenHeight <= 0 || replay->header.screenHeight > REPLAY_MAX_SCREEN_SIZE) {
+        fclose(file);
+        return false;
+    }
+
+    // Kayıtların geri kalanı tek seferde okunur
+    long start = ftell(file);
+    fseek(file, 0, SEEK_END);
+    long end = ftell(file);
+    fseek(file, start, SEEK_SET);
+
+    size_t size = (end > start) ? (size_t)(end - start) : 0;
+    if (size > 0) {
+        replay->data = malloc(size);
+        if (replay->data == NULL || fread(replay->data, 1, size, file) != size) {
+            fclose(file);
+            ReplayFree(replay);
+            return false;
+        }
+    }
+    replay->size = size;
+    replay->capacity = size;
+
+    fclose(file);
+    return true;
+}
+
+// === Oynatma ===
+void ReplayInitWorld(const Replay *replay, GameWorld *world) {
+    SimInitWorld(world, replay->header.level, (float)replay->header.screenWidth,
+                 (float)replay->header.screenHeight, replay->header.seed);
+}
+
+void ReplayPlayerInit(ReplayPlayer *player, const Replay *replay) {
+    memset(player, 0, sizeof(*player));
+    player->replay = replay;
+}
+
+bool ReplayPlayerNext(ReplayPlayer *player, SimInput *input, bool *paused) {
+    const Replay *replay = player->replay;
+
+    if (player->tick >= replay->header.tickCount) return false;
+
+    // Yeni kayıt oku
+    if (player->remaining == 0) {
+        uint8_t flags;
+        if (!ReplayReadRecord(replay, &player->offset, &flags, &player->target, &player->remaining)) return false;
+        player->flags = flags & REPLAY_INPUT_MASK;
+    }
+
+    *input = (SimInput){ 0 };
+    input->aimTarget = player->target;
+    input->aimDown = (player->flags & REPLAY_AIM_DOWN) != 0;
+    input->aimReleased = (player->flags & REPLAY_AIM_RELEASED) != 0;
+    input->toggleBulletTime = (player->flags & REPLAY_TOGGLE_BULLET) != 0;
+    input->resumeFromPause = (player->flags & REPLAY_RESUME) != 0;
+    if (paused != NULL) *paused = (player->flags & REPLAY_PAUSED) != 0;
+
+    player->remaining--;
+    player->tick++;
+    return true;
+}
+
+// Tekrar grubunun tamamını tek seferde tüketir (SimAdvance için)
+uint32_t ReplayPlayerNextRun(ReplayPlayer *player, SimInput *input, bool *paused) {
+    if (!ReplayPlayerNext(player, input, paused)) return 0;
+
+    uint32_t count = player->remaining;
+    uint32_t left = player->replay->header.tickCount - player->tick;
+    if (count > left) count = left;
+
+    player->remaining -= count;
+    player->tick += count;
+    return 1 + count;
+}
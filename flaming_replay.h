@@ -0,0 +1,92 @@
+#ifndef FLAMING_REPLAY_H
+#define FLAMING_REPLAY_H
+
+// Girdi kaydı ve tekrar oynatma.
+// Simülasyon deterministik olduğu için bir koşuyu yeniden üretmek için başlangıç
+// bilgisi (level, seed, tick hızı, ekran boyutu) ve her tick'in SimInput'u yeter.
+//
+// Dosya düzeni (tüm sayılar little-endian):
+//   başlık : "FCRP" | uint16 sürüm | uint8 level | uint8 boş | uint64 seed |
+//            uint16 tick hızı | uint16 genişlik | uint16 yükseklik | uint32 tick sayısı
+//   kayıtlar: uint8 bayraklar
+//             [REPLAY_TARGET varsa] float x, float y
+//             [REPLAY_REPEAT varsa] varint n  (kayıt 1 + n ardışık tick için geçerli)
+//
+// Nişan noktası yalnızca aimDown tick'lerinde ve değiştiğinde yazılır; SimStep
+// aimTarget'ı başka tick'lerde okumaz. Aynı girdiyle geçen tick'ler tek kayıtta
+// birleştirilir, bu yüzden hareketsiz beklenen saniyeler birkaç bayta sığar.
+
+#include "flaming_sim.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#define REPLAY_MAGIC "FCRP"
+#define REPLAY_VERSION 3  // 3: kapalı biçimli lazer açısı; 2: sürekli çarpışma (flaming_ccd.h). Eski kayıtlar aynı koşuyu üretmez
+#define REPLAY_HEADER_SIZE 26
+#define REPLAY_MAX_TICK_RATE 1000    // Oyunun biriktiricisi ve ekransız doğrulama bundan hızlı kayıtları kabul etmez
+#define REPLAY_MAX_SCREEN_SIZE 4096  // px; dünya (ızgara, uzaklık alanı) ekran boyutuyla büyür
+
+// Kayıt bayrakları
+#define REPLAY_AIM_DOWN      0x01
+#define REPLAY_AIM_RELEASED  0x02
+#define REPLAY_TOGGLE_BULLET 0x04
+#define REPLAY_RESUME        0x08
+#define REPLAY_PAUSED        0x10  // Bu tick'ten önce oyun durduruldu (simülasyonu etkilemez)
+#define REPLAY_TARGET        0x40
+#define REPLAY_REPEAT        0x80
+#define REPLAY_INPUT_MASK    0x1F
+
+typedef struct {
+    int version;
+    int level;
+    uint64_t seed;
+    int tickRate;
+    int screenWidth;
+    int screenHeight;
+    uint32_t tickCount;
+} ReplayHeader;
+
+typedef struct {
+    ReplayHeader header;
+    unsigned char *data;  // Kayıtlar (başlık hariç)
+    size_t size;
+    size_t capacity;
+
+    // Kayıt sırasında henüz yazılmamış tekrar grubu
+    uint8_t runFlags;
+    uint32_t runLength;
+    bool runHasTarget;
+    Vector2 lastTarget;  // Son yazılan nişan noktası
+    bool hasTarget;
+    bool pausePending;
+    bool failed;  // Bellek yetmedi; kayıt eksik
+} Replay;
+
+typedef struct {
+    const Replay *replay;
+    size_t offset;
+    uint32_t tick;
+    uint8_t flags;
+    uint32_t remaining;  // Geçerli kaydın kalan tick sayısı
+    Vector2 target;
+} ReplayPlayer;
+
+// === Kayıt ===
+void ReplayBeginRecording(Replay *replay, int level, uint64_t seed, int tickRate, int screenWidth, int screenHeight);
+bool ReplayRecordTick(Replay *replay, const SimInput *input);
+void ReplayRecordPause(Replay *replay);  // Sonraki tick'e REPLAY_PAUSED eklenir
+void ReplayTruncate(Replay *replay, uint32_t tickCount);  // İlk tickCount tick kalır
+bool ReplayFinishRecording(Replay *replay);
+void ReplayFree(Replay *replay);
+
+// === Dosya ===
+bool ReplaySave(const Replay *replay, const char *fileName);
+bool ReplayLoad(Replay *replay, const char *fileName);
+
+// === Oynatma ===
+void ReplayInitWorld(const Replay *replay, GameWorld *world);
+void ReplayPlayerInit(ReplayPlayer *player, const Replay *replay);
+bool ReplayPlayerNext(ReplayPlayer *player, SimInput *input, bool *paused);  // Kayıt bitince false
+uint32_t ReplayPlayerNextRun(ReplayPlayer *player, SimInput *input, bool *paused);  // Aynı girdili tick sayısı; bitince 0
+
+#endif // FLAMING_REPLAY_H
@@ -0,0 +1,201 @@
+#include "flaming_rewind.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define REWIND_MIN_ZERO_RUN 4  // Daha kısa aynı bölümler farklı bölüme katılır
+#define REWIND_SCRATCH_SIZE (2 * sizeof(GameWorld) + 16)  // En kötü durumda kodlanmış fark
+
+// === Fark kodlama ===
+static unsigned char *PutVarint(unsigned char *out, uint32_t value) {
+    while (value >= 0x80) {
+        *out++ = (unsigned char)(value | 0x80);
+        value >>= 7;
+    }
+    *out++ = (unsigned char)value;
+    return out;
+}
+
+static const unsigned char *GetVarint(const unsigned char *in, uint32_t *value) {
+    uint32_t result = 0;
+    for (int shift = 0; ; shift += 7) {
+        result |= (uint32_t)(*in & 0x7F) << shift;
+        if (!(*in++ & 0x80)) break;
+    }
+    *value = result;
+    return in;
+}
+
+// a ve b arasındaki XOR farkını out'a yazar, yazılan bayt sayısını döndürür
+static size_t EncodeDelta(const unsigned char *a, const unsigned char *b, size_t size, unsigned char *out) {
+    unsigned char *start = out;
+    size_t i = 0;
+
+    while (i < size) {
+        // Aynı bölüm: 8 baytlık bloklarla hızlı geç
+        size_t same = i;
+        while (same + 8 <= size) {
+            uint64_t wordA, wordB;
+            memcpy(&wordA, a + same, 8);
+            memcpy(&wordB, b + same, 8);
+            if (wordA != wordB) break;
+            same += 8;
+        }
+        while (same < size && a[same] == b[same]) same++;
+
+        // Farklı bölüm: REWIND_MIN_ZERO_RUN aynı bayt gelene kadar sürer
+        size_t different = same;
+        while (different < size) {
+            if (a[different] != b[different]) {
+                different++;
+                continue;
+            }
+
+            size_t run = different;
+            while (run < size && run - different < REWIND_MIN_ZERO_RUN && a[run] == b[run]) run++;
+            if (run - different >= REWIND_MIN_ZERO_RUN || run == size) break;
+            different = run;
+        }
+
+        out = PutVarint(out, (uint32_t)(same - i));
+        out = PutVarint(out, (uint32_t)(different - same));
+        for (size_t j = same; j < different; j++) *out++ = a[j] ^ b[j];
+
+        i = different;
+    }
+
+    return (size_t)(out - start);
+}
+
+static void ApplyDelta(unsigned char *target, const unsigned char *delta, size_t deltaSize) {
+    const unsigned char *end = delta + deltaSize;
+    size_t position = 0;
+
+    while (delta < end) {
+        uint32_t same, different;
+        delta = GetVarint(delta, &same);
+        delta = GetVarint(delta, &different);
+
+        position += same;
+        for (uint32_t j = 0; j < different; j++) target[position++] ^= *delta++;
+    }
+}
+
+// === Halka tampon ===
+bool RewindCreate(RewindBuffer *rewind, int maxFrames, size_t capacity) {
+    memset(rewind, 0, sizeof(*rewind));
+
+    rewind->data = malloc(capacity);
+    rewind->frames = calloc((size_t)maxFrames, sizeof(RewindFrame));
+    rewind->scratch = malloc(REWIND_SCRATCH_SIZE);
+
+    if (rewind->data == NULL || rewind->frames == NULL || rewind->scratch == NULL) {
+        RewindDestroy(rewind);
+        return false;
+    }
+
+    rewind->capacity = capacity;
+    rewind->maxFrames = maxFrames;
+    return true;
+}
+
+void RewindDestroy(RewindBuffer *rewind) {
+    free(rewind->data);
+    free(rewind->frames);
+    free(rewind->scratch);
+    memset(rewind, 0, sizeof(*rewind));
+}
+
+void RewindReset(RewindBuffer *rewind, const GameWorld *world) {
+    rewind->writeOffset = 0;
+    rewind->first = 0;
+    rewind->count = 0;
+    rewind->current = *world;
+    rewind->hasCurrent = true;
+}
+
+static void RewindDropOldest(RewindBuffer *rewind) {
+    rewind->first = (rewind->first + 1) % rewind->maxFrames;
+    rewind->count--;
+}
+
+void RewindPush(RewindBuffer *rewind, const GameWorld *world) {
+    if (rewind->data == NULL) return;
+    if (!rewind->hasCurrent) {
+        RewindReset(rewind, world);
+        return;
+    }
+
+    size_t size = EncodeDelta((const unsigned char *)world, (const unsigned char *)&rewind->current,
+                              sizeof(GameWorld), rewind->scratch);
+
+    // Fark tampondan büyükse geçmiş bu kareden yeniden başlar
+    if (size > rewind->capacity) {
+        RewindReset(rewind, world);
+        return;
+    }
+
+    if (rewind->count == rewind->maxFrames) RewindDropOldest(rewind);
+
+    // Kare bitişik yazılır; yer yoksa sığana kadar en eski kareler atılır
+    size_t offset;
+    for (;;) {
+        if (rewind->count == 0) {
+            offset = 0;
+            break;
+        }
+
+        size_t tail = rewind->frames[rewind->first].offset;
+        offset = rewind->writeOffset;
+
+        if (offset > tail) {
+            // Dolu bölge [tail, writeOffset): boş yer sonda ya da başta
+            if (offset + size <= rewind->capacity) break;
+            if (size <= tail) {
+                offset = 0;
+                break;
+            }
+        }
+        else if (offset + size <= tail) {
+            // Başa sarılmış: boş yer [writeOffset, tail)
+            break;
+        }
+
+        RewindDropOldest(rewind);
+    }
+
+    memcpy(rewind->data + offset, rewind->scratch, size);
+
+    RewindFrame *frame = &rewind->frames[(rewind->first + rewind->count) % rewind->maxFrames];
+    frame->offset = (uint32_t)offset;
+    frame->size = (uint32_t)size;
+    rewind->count++;
+
+    rewind->writeOffset = offset + size;
+    rewind->current = *world;
+}
+
+bool RewindStepBack(RewindBuffer *rewind, GameWorld *world) {
+    if (rewind->count == 0) return false;
+
+    int newest = (rewind->first + rewind->count - 1) % rewind->maxFrames;
+    const RewindFrame *frame = &rewind->frames[newest];
+
+    ApplyDelta((unsigned char *)&rewind->current, rewind->data + frame->offset, frame->size);
+    rewind->writeOffset = frame->offset;
+    rewind->count--;
+
+    *world = rewind->current;
+    return true;
+}
+
+int RewindFrameCount(const RewindBuffer *rewind) {
+    return rewind->count;
+}
+
+size_t RewindBytesUsed(const RewindBuffer *rewind) {
+    size_t bytes = 0;
+    for (int i = 0; i < rewind->count; i++) {
+        bytes += rewind->frames[(rewind->first + i) % rewind->maxFrames].size;
+    }
+    return bytes;
+}
@@ -0,0 +1,52 @@
+#ifndef FLAMING_REWIND_H
+#define FLAMING_REWIND_H
+
+// Geri sarma: son birkaç saniyenin dünya durumlarını sabit boyutlu bir halka
+// tamponda tutar.
+//
+// Her tick'te tam GameWorld yerine önceki durumla XOR farkı saklanır ve bu fark
+// sıfır blokları atlanarak (RLE) sıkıştırılır: bir tick'te yalnızca birkaç alan
+// değiştiği için kare başına birkaç yüz bayt yeter. XOR kendi tersi olduğundan
+// en yeni fark şimdiki duruma uygulanınca bir önceki durum elde edilir; şimdiki
+// durum böylece anahtar kare işlevi görür ve geri sarma her adımda O(fark)
+// maliyetindedir. Bayt bütçesi ya da kare sınırı dolunca en eski kareler atılır.
+//
+// Fark kaydı (tekrarlı): varint aynı bayt sayısı | varint farklı bayt sayısı | XOR baytları
+
+#include "flaming_sim.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#define REWIND_SECONDS 10
+#define REWIND_BUFFER_BYTES (1792 * 1024)  // Kare tablosu ve şimdiki durumla birlikte < 2 MB
+
+typedef struct {
+    uint32_t offset;  // Halka tampondaki başlangıç
+    uint32_t size;
+} RewindFrame;
+
+typedef struct {
+    unsigned char *data;  // Halka tampon
+    size_t capacity;
+    size_t writeOffset;  // Sonraki karenin yazılacağı yer
+
+    RewindFrame *frames;  // Halka; frames[first] en eski fark
+    int maxFrames;
+    int first;
+    int count;
+
+    GameWorld current;  // Son eklenen durum
+    bool hasCurrent;
+    unsigned char *scratch;  // Kodlama için geçici alan
+} RewindBuffer;
+
+// === Fonksiyon prototipleri ===
+bool RewindCreate(RewindBuffer *rewind, int maxFrames, size_t capacity);
+void RewindDestroy(RewindBuffer *rewind);
+void RewindReset(RewindBuffer *rewind, const GameWorld *world);  // Geçmişi siler; world başlangıç olur
+void RewindPush(RewindBuffer *rewind, const GameWorld *world);
+bool RewindStepBack(RewindBuffer *rewind, GameWorld *world);     // Geçmiş bittiyse false
+int RewindFrameCount(const RewindBuffer *rewind);
+size_t RewindBytesUsed(const RewindBuffer *rewind);
+
+#endif // FLAMING_REWIND_H
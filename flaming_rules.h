@@ -0,0 +1,832 @@
+#ifndef FLAMING_RULES_H
+#define FLAMING_RULES_H
+
+// Oyun kuralları: çarpışma testleri, hareket formülleri ve bir tick'in kendisi.
+// SimStep (flaming_sim.c) ve SimStepBatch (flaming_batch.c) tick'i aynı gövdeyle
+// (SimTickBegin, SimTickRun) ilerletir; böylece iki motor aynı girdiyle aynı
+// sonucu üretir.
+
+#include "flaming_ccd.h"
+#include "flaming_grid.h"
+#include "flaming_sdf.h"
+#include "flaming_sim.h"
+#include "flaming_simd.h"
+#include <math.h>
+#include <string.h>
+
+#define SIM_DEG2RAD (3.14159265358979323846f/180.0f)
+
+#define CORE_RADIUS 20.0f
+#define CORE_SPEED 500.0f
+#define FIREBALL_SPEED 200.0f
+#define FIREBALL_RADIUS 8.0f
+#define FIREBALL_LIFETIME 5.0f
+#define FIREBALL_SCREEN_MARGIN 20
+#define CORE_EXPLOSION_DURATION 1.5f
+#define OBSTACLE_EXPLOSION_DURATION 0.5f
+
+// === Yardımcı matematik (raymath ile aynı sonuçları verir) ===
+static inline Vector2 SimVec2Subtract(Vector2 a, Vector2 b) {
+    return (Vector2){ a.x - b.x, a.y - b.y };
+}
+
+static inline Vector2 SimVec2Add(Vector2 a, Vector2 b) {
+    return (Vector2){ a.x + b.x, a.y + b.y };
+}
+
+static inline Vector2 SimVec2Scale(Vector2 v, float scale) {
+    return (Vector2){ v.x * scale, v.y * scale };
+}
+
+static inline float SimVec2Length(Vector2 v) {
+    return sqrtf(v.x * v.x + v.y * v.y);
+}
+
+static inline float SimVec2Dot(Vector2 a, Vector2 b) {
+    return a.x * b.x + a.y * b.y;
+}
+
+static inline Vector2 SimVec2Normalize(Vector2 v) {
+    Vector2 result = { 0 };
+    float length = sqrtf(v.x * v.x + v.y * v.y);
+
+    if (length > 0) {
+        float ilength = 1.0f / length;
+        result.x = v.x * ilength;
+        result.y = v.y * ilength;
+    }
+
+    return result;
+}
+
+// === Çarpışma testleri ===
+
+// raylib CheckCollisionCircles ile aynı kural
+static inline bool SimCirclesOverlap(Vector2 center1, float radius1, Vector2 center2, float radius2) {
+    float dx = center2.x - center1.x;
+    float dy = center2.y - center1.y;
+    float radiusSum = radius1 + radius2;
+    return (dx * dx + dy * dy) <= radiusSum * radiusSum;
+}
+
+// raylib CheckCollisionPointLine ile aynı kural (eşik tam sayıya yuvarlanır)
+static inline bool SimPointNearLine(Vector2 point, Vector2 p1, Vector2 p2, int threshold) {
+    bool collision = false;
+    float dxc = point.x - p1.x;
+    float dyc = point.y - p1.y;
+    float dxl = p2.x - p1.x;
+    float dyl = p2.y - p1.y;
+    float cross = dxc * dyl - dyc * dxl;
+
+    if (fabsf(cross) < (threshold * fmaxf(fabsf(dxl), fabsf(dyl)))) {
+        if (fabsf(dxl) >= fabsf(dyl))
+            collision = (dxl > 0) ? ((p1.x <= point.x) && (point.x <= p2.x)) : ((p2.x <= point.x) && (point.x <= p1.x));
+        else
+            collision = (dyl > 0) ? ((p1.y <= point.y) && (point.y <= p2.y)) : ((p2.y <= point.y) && (point.y <= p1.y));
+    }
+
+    return collision;
+}
+
+// === Statik doğru parçaları ===
+// SimPointNearLine'ın nokta içermeyen kısmı önceden hesaplanır; SimSegmentHit
+// aynı işlemleri aynı sırayla yaptığı için sonuç bit bit aynıdır. Baskın
+// eksendeki p1-p2 aralığı küçük-büyük sıralı saklanır (yön testine gerek kalmaz).
+static inline void SimSegmentSet(SimSegmentTable *table, int i, Vector2 p1, Vector2 p2, int threshold) {
+    float dxl = p2.x - p1.x;
+    float dyl = p2.y - p1.y;
+    bool alongX = fabsf(dxl) >= fabsf(dyl);
+
+    table->originX[i] = p1.x;
+    table->originY[i] = p1.y;
+    table->deltaX[i] = dxl;
+    table->deltaY[i] = dyl;
+    table->limit[i] = threshold * fmaxf(fabsf(dxl), fabsf(dyl));
+    table->low[i] = alongX ? fminf(p1.x, p2.x) : fminf(p1.y, p2.y);
+    table->high[i] = alongX ? fmaxf(p1.x, p2.x) : fmaxf(p1.y, p2.y);
+    table->axisMask[i] = alongX ? 0 : -1;
+}
+
+static inline bool SimSegmentHit(const SimSegmentTable *table, int i, Vector2 point) {
+    float dxc = point.x - table->originX[i];
+    float dyc = point.y - table->originY[i];
+    float cross = dxc * table->deltaY[i] - dyc * table->deltaX[i];
+
+    if (!(fabsf(cross) < table->limit[i])) return false;
+
+    float coordinate = table->axisMask[i] ? point.y : point.x;
+    return (table->low[i] <= coordinate) && (coordinate <= table->high[i]);
+}
+
+// Nokta from'dan from + displacement'a giderken parçanın bölgesine
+// (SimSegmentHit'in kabul ettiği paralelkenar: |cross| < limit ve baskın
+// eksende low..high) ilk girdiği an, hareketin kesri olarak [0, 1]; girmiyorsa
+// SIM_SEGMENT_MISS. Vektör çekirdekleri aynı işlemleri aynı sırayla yapar;
+// min/max bu yüzden (a < b) ? a : b biçiminde yazılır.
+#define SIM_SEGMENT_MISS 2.0f
+
+static inline float SimSegmentEnter(const SimSegmentTable *table, int i, Vector2 from, Vector2 displacement) {
+    float dxc = from.x - table->originX[i];
+    float dyc = from.y - table->originY[i];
+    float cross = dxc * table->deltaY[i] - dyc * table->deltaX[i];
+    float crossRate = displacement.x * table->deltaY[i] - displacement.y * table->deltaX[i];
+    float limit = table->limit[i];
+    float enter = 0.0f;
+    float leave = 1.0f;
+
+    // Dik uzaklık açık aralıkta kalmalı
+    if (crossRate != 0.0f) {
+        float t1 = (-limit - cross) / crossRate;
+        float t2 = (limit - cross) / crossRate;
+        float low = (t1 < t2) ? t1 : t2;
+        float high = (t1 > t2) ? t1 : t2;
+        enter = (low > enter) ? low : enter;
+        leave = (high < leave) ? high : leave;
+        if (!(enter < leave)) return SIM_SEGMENT_MISS;
+    }
+    else if (!(fabsf(cross) < limit)) {
+        return SIM_SEGMENT_MISS;
+    }
+
+    // Baskın eksende parçanın içinde (kapalı aralık)
+    float coordinate = table->axisMask[i] ? from.y : from.x;
+    float coordinateRate = table->axisMask[i] ? displacement.y : displacement.x;
+    if (coordinateRate != 0.0f) {
+        float t1 = (table->low[i] - coordinate) / coordinateRate;
+        float t2 = (table->high[i] - coordinate) / coordinateRate;
+        float low = (t1 < t2) ? t1 : t2;
+        float high = (t1 > t2) ? t1 : t2;
+        enter = (low > enter) ? low : enter;
+        leave = (high < leave) ? high : leave;
+    }
+    else if (coordinate < table->low[i] || coordinate > table->high[i]) {
+        return SIM_SEGMENT_MISS;
+    }
+
+    return (enter <= leave) ? enter : SIM_SEGMENT_MISS;
+}
+
+// indices'teki parçalardan ilk girilenin anı; *hit liste içindeki sırası ya da
+// -1. Aynı anda girilenlerden listede önce geleni seçilir.
+static inline float SimSegmentFirstEnter(const SimSegmentTable *table, const uint16_t *indices, int count,
+                                         Vector2 from, Vector2 displacement, int *hit) {
+    float first = SIM_SEGMENT_MISS;
+    *hit = -1;
+    for (int k = 0; k < count; k++) {
+        float enter = SimSegmentEnter(table, indices[k], from, displacement);
+        if (enter < first) {
+            first = enter;
+            *hit = k;
+        }
+    }
+    return first;
+}
+
+// Lazer ve duvar testlerinde kullanılan eşikler (raylib'deki gibi int'e kesilir)
+static inline int SimLaserThreshold(float coreRadius) {
+    return (int)(LASER_THICKNESS / 2 + coreRadius);
+}
+
+static inline int SimWallThreshold(float thickness, float coreRadius) {
+    return (int)(thickness / 2 + coreRadius);
+}
+
+// Pasif duvarların limiti 0'dır; hiçbir noktaya değmezler
+static inline void SimBuildWallSegments(SimSegmentTable *table, const DeadlyWall *walls, int count, float coreRadius) {
+    table->count = count;
+    for (int i = 0; i < count; i++) {
+        SimSegmentSet(table, i, walls[i].startPos, walls[i].endPos, SimWallThreshold(walls[i].thickness, coreRadius));
+        if (!walls[i].active) table->limit[i] = 0.0f;
+    }
+}
+
+// Lazerin ucunu hesaplamadan önceki kaba test. SimPointNearLine ancak nokta
+// doğru parçasına dik uzaklıkta eşikten, boyunca da uzunluk + eşikten yakınsa
+// doğru döner; bu yüzden merkeze LASER_LENGTH + 2 * eşik'ten uzak bir nokta
+// lazere hiçbir açıda değemez ve sin/cos atlanabilir.
+static inline bool SimLaserInReach(Vector2 point, Vector2 position, int threshold) {
+    float dx = point.x - position.x;
+    float dy = point.y - position.y;
+    float reach = LASER_LENGTH + 2.0f * threshold + 1.0f;
+    return (dx * dx + dy * dy) <= reach * reach;
+}
+
+// from'dan to'ya giden çember merkezi center'a tick boyunca radius'tan yakın
+// geçiyor mu (doğru parçasının en yakın noktası). Ateş topu vektör
+// çekirdekleri de aynı işlemleri aynı sırayla yapar.
+static inline bool SimSweptCircleHit(Vector2 from, Vector2 to, Vector2 center, float radius) {
+    float sx = to.x - from.x;
+    float sy = to.y - from.y;
+    float dx = center.x - from.x;
+    float dy = center.y - from.y;
+    float length = sx * sx + sy * sy;
+
+    // Uzak top: (radius + |s|)^2 <= 2 * (radius^2 + |s|^2); 4 kat pay yuvarlamaya
+    // yer bırakmaz, sonuç tam testle aynıdır ve bölme atlanır
+    if (dx * dx + dy * dy > 4.0f * (radius * radius + length)) return false;
+
+    float t = (length > 0.0f) ? (dx * sx + dy * sy) / length : 0.0f;
+    t = (t > 0.0f) ? t : 0.0f;
+    t = (t < 1.0f) ? t : 1.0f;
+
+    float ex = dx - sx * t;
+    float ey = dy - sy * t;
+    return (ex * ex + ey * ey) <= radius * radius;
+}
+
+// Ekrandan çıkan ya da ömrü dolan ateş topu
+static inline bool SimFireballExpired(Vector2 position, float lifeTime, float screenWidth, float screenHeight) {
+    return position.x < -FIREBALL_SCREEN_MARGIN || position.x > screenWidth + FIREBALL_SCREEN_MARGIN ||
+           position.y < -FIREBALL_SCREEN_MARGIN || position.y > screenHeight + FIREBALL_SCREEN_MARGIN ||
+           lifeTime > FIREBALL_LIFETIME;
+}
+
+// === Patlama parçacıkları ===
+// Her patlama türü bir yayıcıdır: kaç parçacık çıktığı, hız ve yarıçap
+// aralıkları (tam sayı, SimRngRange), renk paleti ve ömür. Parçacık doğduğu
+// andan (spawnTime, levelTime cinsinden) sonra düz çizgide gider ve alfası 1'den
+// 0'a doğrusal iner. Tick'ler parçacıklara yazmaz; konum ve alfa istenen an için
+// kapalı formda hesaplanır (SimEvalParticles).
+typedef enum {
+    EMITTER_CORE,
+    EMITTER_SHOOTER,
+    EMITTER_LASER,
+    EMITTER_COUNT
+} EmitterType;
+
+typedef struct {
+    int count;
+    int minSpeed;
+    int maxSpeed;
+    int minRadius;
+    int maxRadius;
+    ParticlePalette palette;
+    float lifetime;  // Saniye
+} SimEmitter;
+
+static const SimEmitter simEmitters[EMITTER_COUNT] = {
+    [EMITTER_CORE] = { EXPLOSION_PARTICLES, 100, 300, 3, 8, PALETTE_CORE, 1.0f },
+    [EMITTER_SHOOTER] = { OBSTACLE_EXPLOSION_PARTICLES, 80, 200, 2, 6, PALETTE_SHOOTER, 0.5f },
+    [EMITTER_LASER] = { OBSTACLE_EXPLOSION_PARTICLES, 80, 200, 2, 6, PALETTE_LASER, 0.5f }
+};
+
+// Bir parçacık dizisinin hareket alanları; ParticleSet'in dolu kısmı ya da
+// benchmark'taki gibi herhangi uzunlukta diziler
+typedef struct {
+    const float *originX;
+    const float *originY;
+    const float *velocityX;
+    const float *velocityY;
+    const float *spawnTime;
+    const float *lifetime;
+    int count;
+} SimParticleSpan;
+
+static inline SimParticleSpan SimLiveParticles(const ParticleSet *particles) {
+    return (SimParticleSpan){
+        particles->originX, particles->originY, particles->velocityX, particles->velocityY,
+        particles->spawnTime, particles->lifetime, particles->count
+    };
+}
+
+// Parçacıkların time anındaki konumu ve alfası. Ömrü dolmuş parçacığın alfası 0
+// ya da negatiftir; doğmadan önceki bir an doğum anına çekilir. Dallanmasız
+// geçiş SIM_PARTICLE_LANES'lik bloklarla yapılır: sabit uzunluklu iç döngüyü
+// gcc -O2'de de vektörleştirir. count bu yüzden blok katına yuvarlanmış gibi
+// okunup yazılır; diziler o kadar uzun olmalıdır (ParticleSet'te öyledir).
+static inline void SimEvalParticles(const SimParticleSpan *span, float time,
+                                    float *restrict x, float *restrict y, float *restrict alpha) {
+    const float *restrict originX = span->originX;
+    const float *restrict originY = span->originY;
+    const float *restrict velocityX = span->velocityX;
+    const float *restrict velocityY = span->velocityY;
+    const float *restrict spawnTime = span->spawnTime;
+    const float *restrict lifetime = span->lifetime;
+    int count = span->count;
+
+    for (int first = 0; first < count; first += SIM_PARTICLE_LANES) {
+        for (int i = first; i < first + SIM_PARTICLE_LANES; i++) {
+            float age = time - spawnTime[i];
+            age = (age > 0.0f) ? age : 0.0f;
+            x[i] = originX[i] + velocityX[i] * age;
+            y[i] = originY[i] + velocityY[i] * age;
+            alpha[i] = 1.0f - age / lifetime[i];
+        }
+    }
+}
+
+// Ömrü now'a kadar dolan parçacıkların yerine sonuncuyu taşır; sıra belirlenimcidir
+static inline void SimRetireParticles(ParticleSet *particles, float now) {
+    int i = 0;
+
+    while (i < particles->count) {
+        if (now - particles->spawnTime[i] < particles->lifetime[i]) {
+            i++;
+            continue;
+        }
+
+        int last = --particles->count;
+        particles->originX[i] = particles->originX[last];
+        particles->originY[i] = particles->originY[last];
+        particles->velocityX[i] = particles->velocityX[last];
+        particles->velocityY[i] = particles->velocityY[last];
+        particles->spawnTime[i] = particles->spawnTime[last];
+        particles->lifetime[i] = particles->lifetime[last];
+        particles->radius[i] = particles->radius[last];
+        particles->palette[i] = particles->palette[last];
+        particles->shade[i] = particles->shade[last];
+    }
+}
+
+// Yayıcının parçacıklarını now anında origin'den saçar. Havuz yalnızca burada
+// toplanır: önce ömrü dolanlar çıkarılır. Kapasite en kötü durumu karşıladığından
+// havuz dolmaz; sınır denetimi yalnızca bellek güvenliği içindir ve rastgele
+// sayılar her durumda çekilir (RNG akışı havuzun boyutuna bağlı kalmaz).
+static inline void SimEmitParticles(ParticleSet *particles, SimRng *rng, EmitterType type, Vector2 origin,
+                                    float now) {
+    const SimEmitter *emitter = &simEmitters[type];
+
+    SimRetireParticles(particles, now);
+
+    for (int k = 0; k < emitter->count; k++) {
+        float angle = SimRngRange(rng, 0, 360) * SIM_DEG2RAD;
+        float speed = SimRngRange(rng, emitter->minSpeed, emitter->maxSpeed);
+        float radius = SimRngRange(rng, emitter->minRadius, emitter->maxRadius);
+        unsigned char shade = (unsigned char)SimRngRange(rng, 0, 2);
+        if (particles->count == SIM_PARTICLE_CAPACITY) continue;
+
+        int i = particles->count++;
+        particles->originX[i] = origin.x;
+        particles->originY[i] = origin.y;
+        particles->velocityX[i] = cosf(angle) * speed;
+        particles->velocityY[i] = sinf(angle) * speed;
+        particles->spawnTime[i] = now;
+        particles->lifetime[i] = emitter->lifetime;
+        particles->radius[i] = radius;
+        particles->palette[i] = (unsigned char)emitter->palette;
+        particles->shade[i] = shade;
+    }
+}
+
+// === Ateş topu havuzu ===
+// Aktif slotlar SIM_FIREBALL_WORDS kelimelik bir bit haritasında tutulur
+// (GameWorld::fireballSlots; slot i, i / 64. kelimenin i % 64. biti); yeni ateş
+// topu her zaman en küçük boş slota girer, yani eski doğrusal taramayla aynı slota.
+// Slot sırası güncelleme sırasıdır ve kayıtlar ile SimWorldHash buna bağlıdır.
+
+// Bir shooter'ın aynı anda havada tutabileceği en fazla ateş topu. Atışlar arası
+// en az interval, ömür en fazla FIREBALL_LIFETIME + 2 tick (ikisi de timeScale ile
+// ölçeklenir); tick interval'den kısa olduğu sürece floor(ömür / interval) + 1 aşılmaz.
+// interval >= MIN_SHOOT_INTERVAL için MAX_SHOOTER_FIREBALLS'u aşmaz.
+static inline int SimShooterFireballBound(float interval) {
+    return (int)(FIREBALL_LIFETIME / interval) + 2;
+}
+
+static inline void SimFireballSlotSet(uint64_t *slots, int slot) {
+    slots[slot >> 6] |= (uint64_t)1 << (slot & 63);
+}
+
+static inline void SimFireballSlotClear(uint64_t *slots, int slot) {
+    slots[slot >> 6] &= ~((uint64_t)1 << (slot & 63));
+}
+
+static inline bool SimFireballSlotsEmpty(const uint64_t *slots) {
+    uint64_t any = 0;
+    for (int w = 0; w < SIM_FIREBALL_WORDS; w++) any |= slots[w];
+    return any == 0;
+}
+
+// [0, capacity) içindeki en küçük boş slot; havuz doluysa -1
+static inline int SimFireballFreeSlot(const uint64_t *slots, int capacity) {
+    for (int w = 0; w * 64 < capacity; w++) {
+        uint64_t free = ~slots[w];
+        int left = capacity - w * 64;
+        if (left < 64) free &= ((uint64_t)1 << left) - 1;
+        if (free != 0) return w * 64 + __builtin_ctzll(free);
+    }
+    return -1;
+}
+
+// === Hareket kuralları ===
+
+// Hedefe doğru verilen hızla fırlatma
+static inline Vector2 SimLaunchVelocity(Vector2 from, Vector2 target, float speed) {
+    Vector2 direction = SimVec2Subtract(target, from);
+    Vector2 normDirection = SimVec2Normalize(direction);
+    return SimVec2Scale(normDirection, speed);
+}
+
+// Ekran sınırlarına çarpan topun hızını yansıtır
+static inline Vector2 SimBounceOffScreen(Vector2 position, Vector2 velocity, float radius,
+                                         float screenWidth, float screenHeight) {
+    if ((position.x - radius <= 0 && velocity.x < 0) ||
+        (position.x + radius >= screenWidth && velocity.x > 0)) {
+        velocity.x = -velocity.x;
+    }
+    if ((position.y - radius <= 0 && velocity.y < 0) ||
+        (position.y + radius >= screenHeight && velocity.y > 0)) {
+        velocity.y = -velocity.y;
+    }
+    return velocity;
+}
+
+// Engele çarpan topun hızını, hızın büyüklüğünü koruyarak yansıtır
+static inline Vector2 SimReflectOffObstacle(Vector2 corePosition, float coreRadius, Vector2 obstaclePosition,
+                                            Vector2 velocity) {
+    Vector2 collisionPoint = SimVec2Normalize(SimVec2Subtract(obstaclePosition, corePosition));
+    collisionPoint = SimVec2Scale(collisionPoint, coreRadius);
+    collisionPoint = SimVec2Add(corePosition, collisionPoint);
+
+    Vector2 normal = SimVec2Normalize(SimVec2Subtract(collisionPoint, obstaclePosition));
+    Vector2 reflection = SimVec2Subtract(velocity, SimVec2Scale(normal, 2 * SimVec2Dot(velocity, normal)));
+
+    float speed = SimVec2Length(velocity);
+    return SimVec2Scale(SimVec2Normalize(reflection), speed);
+}
+
+// Lazerler birlikte döner; açı level başından beri sayılan tam sayı adımdan
+// kapalı biçimde hesaplanır, böylece tick tick toplamanın kayan nokta kayması
+// birikmez ve atlanan tick'ler (flaming_event.h) tek toplamayla geçilir. Bir
+// adım 90° * dt'dir: normal zamanda tick başına 2 adım (180°/s), bullet-time'da
+// gerçek zamanda yarı hızla 1 adım (90°/s).
+#define SIM_LASER_STEP_DEGREES 90.0
+
+static inline uint32_t SimLaserPhaseStep(bool bulletTimeActive) {
+    return bulletTimeActive ? 1u : 2u;
+}
+
+// Lazerlerin level başından beri döndüğü açı, [0, 360). Tam tur sayısı
+// kesilerek çıkarılır (fmod'dan hızlı); çıkarma tamdır, bölmenin yuvarlaması
+// sınırda düzeltilir. Tick başına bir kez hesaplanır, tüm lazerler paylaşır.
+static inline float SimLaserTurnAt(uint32_t phase, float dt) {
+    double turn = (double)phase * (SIM_LASER_STEP_DEGREES * (double)dt);
+    turn -= 360.0 * (double)(int64_t)(turn * (1.0 / 360.0));
+    if (turn < 0.0) turn += 360.0;
+    else if (turn >= 360.0) turn -= 360.0;
+
+    float result = (float)turn;
+    return (result >= 360.0f) ? 0.0f : result;
+}
+
+// Lazerlerin bir tick'te döndüğü açı (derece); CCD tick içindeki yönleri bununla bulur
+static inline float SimLaserTickTurn(bool bulletTimeActive, float dt) {
+    return (float)(SimLaserPhaseStep(bulletTimeActive) * (SIM_LASER_STEP_DEGREES * (double)dt));
+}
+
+// Topun merkezi lazer doğrusuna bundan uzaksa (kendi yolu hariç) tick boyunca
+// lazere değemez: SimPointNearLine'ın kabul ettiği nokta parçaya eşik * sqrt(2)'den
+// yakındır, lazerin her noktası en çok LASER_LENGTH * dönüş (radyan) yer değiştirir
+static inline float SimLaserBand(float coreRadius, float laserTurn) {
+    return SimLaserThreshold(coreRadius) * 1.41421356f + fabsf(laserTurn) * SIM_DEG2RAD * LASER_LENGTH;
+}
+
+static inline Vector2 SimLaserDirection(float laserAngle) {
+    return (Vector2){ cosf(SIM_DEG2RAD * laserAngle), sinf(SIM_DEG2RAD * laserAngle) };
+}
+
+// Birim karmaşık sayılarla döndürme: a'nın açısına b'ninki eklenir
+static inline Vector2 SimRotate(Vector2 a, Vector2 b) {
+    return (Vector2){ a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x };
+}
+
+// Yarım açılı döndürme; rotation'ın açısı (-180°, 180°) aralığında olmalı
+static inline Vector2 SimHalfRotation(Vector2 rotation) {
+    float c = sqrtf(0.5f * (1.0f + rotation.x));
+    return (Vector2){ c, (c > 0.0f) ? rotation.y / (2.0f * c) : 1.0f };
+}
+
+static inline Vector2 SimLaserEndFrom(Vector2 position, Vector2 direction) {
+    return (Vector2){ position.x + direction.x * LASER_LENGTH, position.y + direction.y * LASER_LENGTH };
+}
+
+// === Tick ===
+// Motor dünyanın oyunu etkileyen durumunu SimTickState'e yükler, SimTickBegin ve
+// SimTickRun'ı çağırır ve durumu kendi düzenine geri yazar. Görsel işler (trail,
+// parçacıklar, beyaz topun patlaması) gövdede yoktur; SimStep onları
+// SimTickResult'tan eski sırasıyla yapar, toplu motorda yoktur.
+
+// Levelin tick boyunca değişmeyen kısmı
+typedef struct {
+    const SimGrid *grid;
+    const SimSegmentTable *walls;        // Ölümcül duvarlar; level 3'ten önce NULL
+    const SimSdf *sdf;                   // Duvarların uzaklık alanı; NULL ise duvarlar alanla elenmez
+    SimFireballKernelFn fireballKernel;
+    SimSegmentKernelFn wallKernel;       // NULL ise SimSegmentFirstEnter; ikisi bit bit aynıdır
+    float coreRadius;
+    float screenWidth;
+    float screenHeight;
+} SimTickLevel;
+
+// Tick'in değiştirdiği durum; alanlar GameWorld'deki aynı adlı alanlardır.
+// Skalerler motorun düzeninden kopyalanır, engeller ve kümeler motorun kendi
+// belleğini gösterir.
+typedef struct {
+    int tick;
+    float levelTime;
+    float completionTime;
+    Vector2 corePosition;
+    Vector2 velocity;
+    Vector2 targetPosition;
+    float timeScale;
+    bool aiming;
+    bool bulletTimeActive;
+    bool gameOver;
+    bool victory;
+    uint32_t laserPhase;
+
+    Obstacle *obstacles;
+    uint16_t *obstacleOrder;
+    int aliveObstacles;
+    int explodingObstacles;
+    LaserSet *lasers;
+    ShooterSet *shooters;
+    FireballSet *fireballs;
+    uint64_t *fireballSlots;
+    int fireballCapacity;
+} SimTickState;
+
+typedef struct {
+    unsigned int events;  // SIM_EVENT_*; patlamanın bitişini SimStep ekler
+    bool moved;           // Oyun sürüyordu ve top bu tick süpürüldü
+    int hitCount;
+    int hits[NUM_OBSTACLES];  // Bu tick patlamaya başlayan engeller, çarpışma sırasıyla
+    Vector2 burnPosition;     // Top yandıysa yandığı yer
+} SimTickResult;
+
+// Aktif ve patlamayan engel; türlerin alive listelerindekiler bunlardır
+static inline bool SimTickObstacleAlive(const Obstacle *obstacle) {
+    return obstacle->active && !obstacle->exploding;
+}
+
+// k'yi türün yaşayanlar listesinden sırası korunarak çıkarır
+static inline void SimTickRemoveAlive(uint16_t *alive, int *aliveCount, int k) {
+    int a = 0;
+    while (alive[a] != k) a++;
+    int last = --*aliveCount;
+    memmove(&alive[a], &alive[a + 1], (size_t)(last - a) * sizeof(alive[0]));
+}
+
+// Çarpılan engel patlamaya başlar: yaşayanlardan sıraları korunarak çıkar,
+// patlayanların başına geçer
+static inline void SimTickExplodeObstacle(SimTickState *state, int obstacleIndex) {
+    Obstacle *obstacle = &state->obstacles[obstacleIndex];
+    obstacle->exploding = true;
+    obstacle->explosionTimer = 0.0f;
+
+    uint16_t *order = state->obstacleOrder;
+    int k = 0;
+    while (order[k] != obstacleIndex) k++;
+    int last = --state->aliveObstacles;
+    memmove(&order[k], &order[k + 1], (size_t)(last - k) * sizeof(order[0]));
+    order[last] = (uint16_t)obstacleIndex;
+    state->explodingObstacles++;
+
+    if (obstacle->type == OBSTACLE_LASER) {
+        SimTickRemoveAlive(state->lasers->alive, &state->lasers->aliveCount, obstacle->kindIndex);
+    }
+    else {
+        SimTickRemoveAlive(state->shooters->alive, &state->shooters->aliveCount, obstacle->kindIndex);
+    }
+}
+
+// Patlayanlar sondan başa gezilir; biten patlama kısmın sonuncusuyla yer
+// değiştirip ölülere geçer, yerine gelen zaten güncellenmiştir
+static inline void SimTickUpdateExplosions(SimTickState *state, float dt) {
+    uint16_t *order = state->obstacleOrder;
+    int first = state->aliveObstacles;
+
+    for (int k = first + state->explodingObstacles - 1; k >= first; k--) {
+        Obstacle *obstacle = &state->obstacles[order[k]];
+
+        obstacle->explosionTimer += dt;
+
+        if (obstacle->explosionTimer >= OBSTACLE_EXPLOSION_DURATION) {
+            obstacle->exploding = false;
+            obstacle->active = false;
+
+            int last = first + --state->explodingObstacles;
+            uint16_t dead = order[k];
+            order[k] = order[last];
+            order[last] = dead;
+        }
+    }
+}
+
+// Beyaz top yanar; oyun biter ve top sahneden çıkar
+static inline void SimTickDestroyCore(SimTickState *state, SimTickResult *result) {
+    result->events |= SIM_EVENT_CORE_DESTROYED;
+    result->burnPosition = state->corePosition;
+    state->gameOver = true;
+    state->corePosition = (Vector2){ -1000, -1000 };
+}
+
+// Ateş toplarını ilerletir, ekrandan çıkanları ya da ömrü dolanları ve beyaz
+// topa değen ilkini kapatır
+static inline void SimTickUpdateFireballs(SimTickState *state, const SimTickLevel *level, float dt,
+                                          SimTickResult *result) {
+    if (SimFireballSlotsEmpty(state->fireballSlots)) return;
+
+    FireballSet *fireballs = state->fireballs;
+    SimFireballSpan span = {
+        fireballs->x, fireballs->y, fireballs->velocityX, fireballs->velocityY,
+        fireballs->lifeTime, fireballs->active, state->fireballSlots, state->fireballCapacity
+    };
+    SimFireballParams params = {
+        dt * state->timeScale, state->corePosition, FIREBALL_RADIUS, level->coreRadius,
+        level->screenWidth, level->screenHeight
+    };
+
+    int hitIndex;
+    level->fireballKernel(&span, &params, &hitIndex);
+    if (hitIndex >= 0) SimTickDestroyCore(state, result);
+}
+
+// En küçük boş slota position'dan target'a doğru ateş topu yerleştirir
+static inline void SimTickSpawnFireball(SimTickState *state, Vector2 position, Vector2 target) {
+    int slot = SimFireballFreeSlot(state->fireballSlots, state->fireballCapacity);
+    if (slot < 0) return;
+
+    FireballSet *fireballs = state->fireballs;
+    Vector2 velocity = SimLaunchVelocity(position, target, FIREBALL_SPEED);
+    fireballs->x[slot] = position.x;
+    fireballs->y[slot] = position.y;
+    fireballs->velocityX[slot] = velocity.x;
+    fireballs->velocityY[slot] = velocity.y;
+    fireballs->radius[slot] = FIREBALL_RADIUS;
+    fireballs->active[slot] = 1;
+    fireballs->lifeTime[slot] = 0.0f;
+    SimFireballSlotSet(state->fireballSlots, slot);
+}
+
+// Tick'in başı: sayaçlar, pause'dan dönüş ve bullet-time tuşu. Tuşa basılan
+// tick'te başka bir şey olmaz; o zaman false döner.
+static inline bool SimTickBegin(SimTickState *state, const SimInput *input, float dt) {
+    state->tick++;
+    state->levelTime += dt;
+
+    // Pause'dan dönüldüğünde oyun bullet-time'da devam eder
+    if (input->resumeFromPause) {
+        state->bulletTimeActive = true;
+        state->timeScale = BULLET_TIME_SCALE;
+    }
+
+    // Space tuşu kontrolü
+    if (input->toggleBulletTime) {
+        state->bulletTimeActive = !state->bulletTimeActive;
+        state->timeScale = state->bulletTimeActive ? BULLET_TIME_SCALE : 1.0f;
+        return false;
+    }
+
+    return true;
+}
+
+// Tick'in geri kalanı: patlamalar, ateş topları, hedefleme, topun hareketi ve
+// çarpışmaları, ateşlemeler ve level sonu
+static inline void SimTickRun(SimTickState *state, const SimTickLevel *level, const SimInput *input, float dt,
+                              SimTickResult *result) {
+    result->events = 0;
+    result->moved = false;
+    result->hitCount = 0;
+
+    SimTickUpdateExplosions(state, dt);
+    SimTickUpdateFireballs(state, level, dt, result);
+
+    if (state->gameOver || state->victory) return;
+
+    // Mouse hedefleme kontrolü
+    if (input->aimDown) {
+        state->aiming = true;
+        state->bulletTimeActive = true;
+        state->timeScale = BULLET_TIME_SCALE;
+        state->targetPosition = input->aimTarget;
+    }
+    else if (input->aimReleased && state->aiming) {
+        state->aiming = false;
+        state->bulletTimeActive = false;
+        state->timeScale = 1.0f;
+        state->velocity = SimLaunchVelocity(state->corePosition, state->targetPosition, CORE_SPEED);
+    }
+
+    // Lazerler tick boyunca döner; CCD tick içindeki yönlerini tick başındaki
+    // yönden ortak dönüşle bulur. Çarpışmalar yalnızca topun tick boyunca
+    // kalacağı ızgara hücresinin adayları için denenir; süpürme birden çok
+    // hücreye taşıyorsa hepsi denenir.
+    float stepTime = dt * state->timeScale;
+    float coreRadius = level->coreRadius;
+    const SimGrid *grid = level->grid;
+    float sweep = SimVec2Length(state->velocity) * stepTime;
+    int cell = SimGridSweepCell(grid, state->corePosition, sweep + 1.0f);
+    const uint16_t *candidate = NULL, *lastCandidate = NULL;
+    if (cell >= 0) SimGridObstacles(grid, cell, &candidate, &lastCandidate);
+
+    float laserTurn = SimLaserTickTurn(state->bulletTimeActive, dt);
+    SimCcdScene scene;
+    SimCcdBegin(&scene, state->corePosition, sweep, coreRadius, laserTurn, SimLaserBand(coreRadius, laserTurn));
+
+    // Çarpışma adayları: önce yaşayan lazerler (yönleri dönmeden önce), sonra
+    // shooter'lar, ikisi de engel indeks sırasında. Top tek hücrede kalıyorsa
+    // hücrenin (çoğunlukla bir iki) adayı, kalmıyorsa türlerin yaşayanları gezilir;
+    // hücre listesi de indeks sırasında olduğundan sıra aynıdır.
+    LaserSet *lasers = state->lasers;
+    if (cell >= 0) {
+        for (const uint16_t *c = candidate; c < lastCandidate; c++) {
+            const Obstacle *obstacle = &state->obstacles[*c];
+            if (obstacle->type != OBSTACLE_LASER || !SimTickObstacleAlive(obstacle)) continue;
+            SimCcdAddLaser(&scene, *c, obstacle->position, obstacle->radius, lasers->direction[obstacle->kindIndex]);
+        }
+    }
+    else {
+        for (int a = 0; a < lasers->aliveCount; a++) {
+            int k = lasers->alive[a];
+            int i = lasers->obstacle[k];
+            const Obstacle *obstacle = &state->obstacles[i];
+            SimCcdAddLaser(&scene, i, obstacle->position, obstacle->radius, lasers->direction[k]);
+        }
+    }
+
+    // Patlamış lazerler de döner; yönleri okuyan olmaz, döngü dallanmaz. Yönler
+    // ortak dönüşün tek sinüs/kosinüsüyle döndürülür; tick'in tek trigonometrisi budur
+    state->laserPhase += SimLaserPhaseStep(state->bulletTimeActive);
+    Vector2 turnDirection = SimLaserDirection(SimLaserTurnAt(state->laserPhase, dt));
+    for (int k = 0; k < lasers->count; k++) {
+        lasers->direction[k] = SimRotate(lasers->baseDirection[k], turnDirection);
+    }
+
+    ShooterSet *shooters = state->shooters;
+    if (cell >= 0) {
+        for (const uint16_t *c = candidate; c < lastCandidate; c++) {
+            const Obstacle *obstacle = &state->obstacles[*c];
+            if (obstacle->type != OBSTACLE_SHOOTER || !SimTickObstacleAlive(obstacle)) continue;
+            SimCcdAddCircle(&scene, *c, obstacle->position, obstacle->radius);
+        }
+    }
+    else {
+        for (int a = 0; a < shooters->aliveCount; a++) {
+            int i = shooters->obstacle[shooters->alive[a]];
+            const Obstacle *obstacle = &state->obstacles[i];
+            SimCcdAddCircle(&scene, i, obstacle->position, obstacle->radius);
+        }
+    }
+
+    // Ölümcül duvarlar; uzaklık alanı topun çevresinde duvar olmadığını
+    // gösteriyorsa test edilmez
+    const SimSdf *sdf = level->sdf;
+    scene.walls = level->walls;
+    scene.wallIndices = NULL;
+    scene.wallCount = 0;
+    scene.wallKernel = level->wallKernel;
+    if (level->walls != NULL &&
+        (sdf == NULL || SimSdfLowerBound(sdf, state->corePosition) <= sdf->coreReach + sweep)) {
+        if (cell >= 0) {
+            SimGridWalls(grid, cell, &candidate, &lastCandidate);
+            scene.wallIndices = candidate;
+            scene.wallCount = (int)(lastCandidate - candidate);
+        }
+        else {
+            scene.wallCount = level->walls->count;
+        }
+    }
+
+    scene.screenWidth = level->screenWidth;
+    scene.screenHeight = level->screenHeight;
+
+    // Oyuncu hareketi: ekran kenarından sekmeler, engel çarpışmaları ve yanma
+    // zaman sırasıyla çözülür
+    SimCcdResult motion;
+    SimCcdResolve(&scene, state->corePosition, state->velocity, stepTime, &motion);
+    state->corePosition = motion.position;
+    state->velocity = motion.velocity;
+    result->moved = true;
+
+    for (int h = 0; h < motion.hitCount; h++) {
+        result->events |= SIM_EVENT_OBSTACLE_DESTROYED;
+        result->hits[result->hitCount++] = motion.hits[h];
+        SimTickExplodeObstacle(state, motion.hits[h]);
+    }
+
+    // Top temas noktasında yanar; patlama oradan başlar
+    if (motion.destroyed) SimTickDestroyCore(state, result);
+
+    // Ateş topu fırlatan engeller; bu tick'te çarpılanlar listeden çıkmıştır
+    for (int a = 0; a < shooters->aliveCount; a++) {
+        int k = shooters->alive[a];
+
+        shooters->shootTimer[k] += dt * state->timeScale;
+
+        // Ateşleme aralığı tamamlandığında yeni ateş topu fırlat
+        if (shooters->shootTimer[k] >= shooters->shootInterval[k]) {
+            shooters->shootTimer[k] = 0.0f;
+            SimTickSpawnFireball(state, state->obstacles[shooters->obstacle[k]].position, state->corePosition);
+        }
+    }
+
+    // Level tamamlama kontrolü
+    if (state->aliveObstacles + state->explodingObstacles == 0) {
+        state->victory = true;
+        state->velocity = (Vector2){ 0.0f, 0.0f };
+        state->completionTime = state->levelTime;
+        result->events |= SIM_EVENT_LEVEL_COMPLETED;
+    }
+}
+
+#endif // FLAMING_RULES_H
@@ -0,0 +1,232 @@
+#include "flaming_sdf.h"
+#include "flaming_rules.h"
+#include "flaming_simd.h"
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define SDF_SQRT2 1.41421356f
+#define SDF_MAX_THREADS 64
+
+// Duvar eksenleri; rows[s].py satırdan bağımsız olarak parçanın başının y'sini tutar
+typedef struct {
+    int count;
+    SimSdfRowSegment rows[MAX_DEADLY_WALLS];
+    SimSdfRowKernelFn kernel;
+} SdfSegments;
+
+typedef struct {
+    SimSdf *sdf;
+    const SdfSegments *segments;
+    int firstRow;
+    int lastRow;
+    pthread_t thread;
+} SdfBand;
+
+// === Hesaplama ===
+// Satırlar birbirinden bağımsızdır; her düğüm için tüm parçalara uzaklığın
+// karesinin en küçüğü alınır (vektör çekirdeği, flaming_simd.h), karekök düğüm
+// başına bir kez
+static void BakeRows(SimSdf *sdf, const SdfSegments *segments, int firstRow, int lastRow) {
+    int cols = sdf->cols;
+
+    for (int r = firstRow; r < lastRow; r++) {
+        float *row = sdf->distance + (size_t)r * cols;
+        float y = (float)r * sdf->cellSize;
+
+        for (int c = 0; c < cols; c++) row[c] = INFINITY;
+
+        for (int s = 0; s < segments->count; s++) {
+            SimSdfRowSegment segment = segments->rows[s];
+            segment.py = y - segment.py;
+            segments->kernel(row, cols, &segment);
+        }
+
+        for (int c = 0; c < cols; c++) row[c] = sqrtf(row[c]);
+    }
+}
+
+static void *BakeBandMain(void *arg) {
+    SdfBand *band = arg;
+    BakeRows(band->sdf, band->segments, band->firstRow, band->lastRow);
+    return NULL;
+}
+
+bool SimSdfBake(SimSdf *sdf, const DeadlyWall *walls, int wallCount, float screenWidth, float screenHeight,
+                float coreRadius, float cellSize, int threadCount) {
+    SdfSegments segments;
+
+    memset(sdf, 0, sizeof(*sdf));
+    sdf->screenWidth = screenWidth;
+    sdf->screenHeight = screenHeight;
+    sdf->coreRadius = coreRadius;
+    sdf->cellSize = cellSize;
+    sdf->inverseCellSize = 1.0f / cellSize;
+    sdf->error = cellSize * SDF_SQRT2;
+    sdf->cols = (int)ceilf(screenWidth / cellSize) + 1;
+    sdf->rows = (int)ceilf(screenHeight / cellSize) + 1;
+    if (sdf->cols < 2) sdf->cols = 2;
+    if (sdf->rows < 2) sdf->rows = 2;
+
+    // SimPointNearLine bölgesi eksene en fazla eşik * sqrt(2) uzaklıktadır
+    segments.count = 0;
+    segments.kernel = SimSdfRowKernel(SimSimdDetect());
+    for (int i = 0; i < wallCount; i++) {
+        if (!walls[i].active) continue;
+
+        int s = segments.count++;
+        float dx = walls[i].endPos.x - walls[i].startPos.x;
+        float dy = walls[i].endPos.y - walls[i].startPos.y;
+        float length2 = dx * dx + dy * dy;
+        float reach = SimWallThreshold(walls[i].thickness, coreRadius) * SDF_SQRT2 + 1.0f;
+
+        segments.rows[s] = (SimSdfRowSegment){
+            .cellSize = cellSize,
+            .ax = walls[i].startPos.x,
+            .py = walls[i].startPos.y,
+            .dx = dx,
+            .dy = dy,
+            .inverseLength2 = (length2 > 0.0f) ? 1.0f / length2 : 0.0f
+        };
+        if (reach > sdf->coreReach) sdf->coreReach = reach;
+    }
+
+    sdf->distance = malloc((size_t)sdf->rows * sdf->cols * sizeof(float));
+    if (sdf->distance == NULL) return false;
+
+    if (threadCount <= 0) {
+        long cores = sysconf(_SC_NPROCESSORS_ONLN);
+        threadCount = (cores > 0) ? (int)cores : 1;
+    }
+    if (threadCount > SDF_MAX_THREADS) threadCount = SDF_MAX_THREADS;
+    if (threadCount > sdf->rows) threadCount = sdf->rows;
+
+    // Satırlar bantlara bölünür; 0. bandı çağıran thread hesaplar, açılamayan
+    // thread'in bandı da onda kalır
+    SdfBand bands[SDF_MAX_THREADS];
+    bool started[SDF_MAX_THREADS] = { false };
+    for (int i = 0; i < threadCount; i++) {
+        bands[i].sdf = sdf;
+        bands[i].segments = &segments;
+        bands[i].firstRow = (int)((long long)sdf->rows * i / threadCount);
+        bands[i].lastRow = (int)((long long)sdf->rows * (i + 1) / threadCount);
+    }
+
+    for (int i = 1; i < threadCount; i++) {
+        started[i] = (pthread_create(&bands[i].thread, NULL, BakeBandMain, &bands[i]) == 0);
+    }
+
+    BakeRows(sdf, &segments, bands[0].firstRow, bands[0].lastRow);
+    for (int i = 1; i < threadCount; i++) {
+        if (started[i]) pthread_join(bands[i].thread, NULL);
+        else BakeRows(sdf, &segments, bands[i].firstRow, bands[i].lastRow);
+    }
+
+    return true;
+}
+
+void SimSdfFree(SimSdf *sdf) {
+    free(sdf->distance);
+    sdf->distance = NULL;
+}
+
+// === Önbellek ===
+// Yazma kilitle, okuma kilitsiz: bir alan tamamen doldurulduktan sonra sayaç
+// release ile artırılır; okuyan acquire ile sayacı görünce alanı da görür
+static SimSdf sdfCache[SIM_SDF_CACHE_SIZE];
+static atomic_int sdfCacheCount;
+static pthread_mutex_t sdfCacheMutex = PTHREAD_MUTEX_INITIALIZER;
+
+// Dünyanın aktif duvarları, sırasıyla
+static int ActiveWalls(const GameWorld *world, DeadlyWall *walls) {
+    int count = 0;
+    for (int i = 0; i < MAX_DEADLY_WALLS; i++) {
+        if (world->deadlyWalls[i].active) walls[count++] = world->deadlyWalls[i];
+    }
+    return count;
+}
+
+static bool SameWall(const DeadlyWall *a, const DeadlyWall *b) {
+    return a->startPos.x == b->startPos.x && a->startPos.y == b->startPos.y &&
+           a->endPos.x == b->endPos.x && a->endPos.y == b->endPos.y && a->thickness == b->thickness;
+}
+
+static int FindSdf(int count, const GameWorld *world, const DeadlyWall *walls, int wallCount) {
+    for (int i = 0; i < count; i++) {
+        const SimSdf *sdf = &sdfCache[i];
+        if (sdf->screenWidth != world->screenWidth || sdf->screenHeight != world->screenHeight ||
+            sdf->coreRadius != world->coreRadius || sdf->wallCount != wallCount) {
+            continue;
+        }
+
+        int w = 0;
+        while (w < wallCount && SameWall(&sdf->walls[w], &walls[w])) w++;
+        if (w == wallCount) return i;
+    }
+    return -1;
+}
+
+int SimLevelSdfSlot(const GameWorld *world) {
+    // Duvarlar yalnızca level 3 ve sonrasında etkilidir
+    if (world->level < 2) return -1;
+
+    DeadlyWall walls[MAX_DEADLY_WALLS];
+    int wallCount = ActiveWalls(world, walls);
+    if (wallCount == 0) return -1;
+
+    int count = atomic_load_explicit(&sdfCacheCount, memory_order_acquire);
+    int slot = FindSdf(count, world, walls, wallCount);
+
+    if (slot < 0) {
+        pthread_mutex_lock(&sdfCacheMutex);
+        count = atomic_load_explicit(&sdfCacheCount, memory_order_relaxed);
+        slot = FindSdf(count, world, walls, wallCount);
+
+        // Hesaplanamayan alan da yazılır (distance NULL); aynı duvarlar yeniden denenmez
+        if (slot < 0 && count < SIM_SDF_CACHE_SIZE) {
+            SimSdf *entry = &sdfCache[count];
+            SimSdfBake(entry, walls, wallCount, world->screenWidth, world->screenHeight, world->coreRadius,
+                       SIM_SDF_CELL_SIZE, 0);
+            entry->wallCount = wallCount;
+            memcpy(entry->walls, walls, sizeof(walls[0]) * (size_t)wallCount);
+            atomic_store_explicit(&sdfCacheCount, count + 1, memory_order_release);
+            slot = count;
+        }
+
+        pthread_mutex_unlock(&sdfCacheMutex);
+    }
+
+    return (slot >= 0 && sdfCache[slot].distance != NULL) ? slot : -1;
+}
+
+const SimSdf *SimWorldSdf(const GameWorld *world) {
+    return (world->sdfSlot >= 0) ? &sdfCache[world->sdfSlot] : NULL;
+}
+
+void SimSdfCacheFree(void) {
+    pthread_mutex_lock(&sdfCacheMutex);
+    int count = atomic_load_explicit(&sdfCacheCount, memory_order_relaxed);
+    for (int i = 0; i < count; i++) SimSdfFree(&sdfCache[i]);
+    atomic_store_explicit(&sdfCacheCount, 0, memory_order_release);
+    pthread_mutex_unlock(&sdfCacheMutex);
+}
+
+// === Işın yürütme ===
+// Alt sınır kadar ilerlemek duvara radius'tan fazla yaklaşmayı hiçbir zaman
+// atlamaz (sphere tracing); adım SIM_SDF_MARCH_MIN_STEP'in altına düşünce
+// duvara varılmış sayılır
+float SimSdfRayMarch(const SimSdf *sdf, Vector2 from, Vector2 direction, float radius, float maxDistance) {
+    float travelled = 0.0f;
+
+    for (int step = 0; step < SIM_SDF_MARCH_MAX_STEPS && travelled < maxDistance; step++) {
+        Vector2 point = { from.x + direction.x * travelled, from.y + direction.y * travelled };
+        float clearance = SimSdfLowerBound(sdf, point) - radius;
+        if (clearance < SIM_SDF_MARCH_MIN_STEP) return travelled;
+        travelled += clearance;
+    }
+
+    return (travelled < maxDistance) ? travelled : maxDistance;
+}
@@ -0,0 +1,110 @@
+#ifndef FLAMING_SDF_H
+#define FLAMING_SDF_H
+
+// Statik geometrinin uzaklık alanı (distance field).
+//
+// Ölümcül duvarlar level boyunca değişmez; level kurulurken ekranı kaplayan bir
+// ızgaranın her düğümüne en yakın duvar eksenine (doğru parçasına) uzaklık bir
+// kez yazılır. Aradaki noktalar çift doğrusal (bilinear) ara değerle okunur.
+//
+// Alan yaklaşık olduğu için çarpışmanın kendisi değildir: SimPointNearLine
+// bölgesi tam hesaplanmaya devam eder (sonuçlar ve kayıtlar değişmez). Alan
+// SimSdfLowerBound ile kesin bir alt sınır verir; SimStep ve SimAdvance topun
+// çevresinde duvar olmadığını tek okumayla anlayıp duvar testlerini atlar,
+// nişan önizlemesi ve botlar SimSdfRayMarch ile ışın yürütür. Ekran kenarları
+// ölümcül değildir ve uzaklıkları zaten kapalı biçimdedir; alana yazılmaz.
+//
+// Alanlar GameWorld'e konmaz (dünya işaretçisiz ve kopyalanabilir kalmalı);
+// süreç boyunca paylaşılan bir önbellekte durur, anahtarı aktif duvarların
+// kendisi, ekran boyutu ve top yarıçapıdır. SetupLevel alanı bir kez çözer ve
+// önbellekteki yerini GameWorld::sdfSlot'a yazar; tick'ler SimWorldSdf ile kilit
+// almadan okur. Önbelleğe yazılan alan bir daha değişmez. Hesaplanamayan alan da
+// önbelleğe yazılır, aynı duvarlar için yeniden denenmez.
+
+#include "flaming_sim.h"
+
+#define SIM_SDF_CELL_SIZE 2.0f  // Düğüm aralığı (px)
+#define SIM_SDF_CACHE_SIZE 16   // Önbellekteki en fazla alan; dolunca alan kullanılmaz
+#define SIM_SDF_ROUNDING 0.01f  // Kayan nokta yuvarlamalarına karşı pay
+#define SIM_SDF_MARCH_MIN_STEP 0.5f
+#define SIM_SDF_MARCH_MAX_STEPS 256
+
+typedef struct {
+    // Önbellek anahtarı; walls yalnızca aktif duvarlar, dünyadaki sırasıyla
+    float screenWidth;
+    float screenHeight;
+    float coreRadius;
+    int wallCount;
+    DeadlyWall walls[MAX_DEADLY_WALLS];
+
+    int cols;
+    int rows;
+    float cellSize;
+    float inverseCellSize;
+    float error;      // Ara değerin en fazla hatası: cellSize * sqrt(2)
+    float coreReach;  // Top merkezi duvara bundan uzaksa SimPointNearLine hiçbir duvarda doğru dönmez
+    float *distance;  // rows * cols; düğüm (c, r) = (c * cellSize, r * cellSize); hesaplanamadıysa NULL
+} SimSdf;
+
+// === Fonksiyon prototipleri ===
+// Aktif duvarlardan alanı hesaplar; threadCount <= 0 tüm çekirdekleri kullanır
+bool SimSdfBake(SimSdf *sdf, const DeadlyWall *walls, int wallCount, float screenWidth, float screenHeight,
+                float coreRadius, float cellSize, int threadCount);
+void SimSdfFree(SimSdf *sdf);
+
+// Dünyanın duvarlarının alanını önbellekte bulur, yoksa hesaplayıp yazar; kilit
+// alır. Önbellekteki yeri ya da -1: duvarsız ya da level 3'ten önceki levellerde,
+// önbellek dolu ya da bellek yetersizse. SetupLevel ve LoadWorldState çağırır.
+int SimLevelSdfSlot(const GameWorld *world);
+
+// SetupLevel'ın çözdüğü alan (GameWorld::sdfSlot); kilitsiz, her tick çağrılabilir
+const SimSdf *SimWorldSdf(const GameWorld *world);
+
+// Hiçbir thread alan okumuyorken çağrılmalı; var olan dünyaların slotları geçersiz olur
+void SimSdfCacheFree(void);
+
+// from'dan direction (birim vektör) yönünde, duvara radius'tan yaklaşmadan
+// gidilebilecek yol; maxDistance'a kadar engel yoksa maxDistance
+float SimSdfRayMarch(const SimSdf *sdf, Vector2 from, Vector2 direction, float radius, float maxDistance);
+
+// === Sorgular ===
+// Noktanın ızgaraya sıkıştırılmış ara değeri; clampDistance sıkıştırmanın kaydırdığı yol (|dx| + |dy|)
+static inline float SimSdfInterpolate(const SimSdf *sdf, Vector2 point, float *clampDistance) {
+    float x = point.x * sdf->inverseCellSize;
+    float y = point.y * sdf->inverseCellSize;
+    float maxX = (float)(sdf->cols - 1);
+    float maxY = (float)(sdf->rows - 1);
+    float cx = (x < 0.0f) ? 0.0f : ((x > maxX) ? maxX : x);
+    float cy = (y < 0.0f) ? 0.0f : ((y > maxY) ? maxY : y);
+
+    int col = (int)cx;
+    int row = (int)cy;
+    if (col > sdf->cols - 2) col = sdf->cols - 2;
+    if (row > sdf->rows - 2) row = sdf->rows - 2;
+    float fx = cx - (float)col;
+    float fy = cy - (float)row;
+
+    const float *d = sdf->distance + row * sdf->cols + col;
+    float top = d[0] + (d[1] - d[0]) * fx;
+    float bottom = d[sdf->cols] + (d[sdf->cols + 1] - d[sdf->cols]) * fx;
+
+    *clampDistance = ((x - cx < 0.0f ? cx - x : x - cx) + (y - cy < 0.0f ? cy - y : y - cy)) * sdf->cellSize;
+    return top + (bottom - top) * fy;
+}
+
+// En yakın duvar eksenine yaklaşık uzaklık
+static inline float SimSdfSample(const SimSdf *sdf, Vector2 point) {
+    float clampDistance;
+    return SimSdfInterpolate(sdf, point, &clampDistance) + clampDistance;
+}
+
+// Gerçek uzaklıktan büyük olmayan değer. Uzaklık 1-Lipschitz olduğundan her
+// düğümdeki değer noktadakinden en fazla düğüme olan uzaklık kadar büyüktür;
+// ağırlıklı ortalama için bu en fazla error'dır.
+static inline float SimSdfLowerBound(const SimSdf *sdf, Vector2 point) {
+    float clampDistance;
+    float value = SimSdfInterpolate(sdf, point, &clampDistance);
+    return value - sdf->error - clampDistance - SIM_SDF_ROUNDING;
+}
+
+#endif // FLAMING_SDF_H
@@ -0,0 +1,675 @@
+#include "flaming_sim.h"
+#include "flaming_grid.h"
+#include "flaming_rules.h"
+#include "flaming_sdf.h"
+#include <math.h>
+#include <string.h>
+
+_Static_assert(SIM_PARTICLE_CAPACITY % SIM_PARTICLE_LANES == 0, "Parçacık havuzu blok katı olmalı");
+_Static_assert(SIM_PARTICLE_CAPACITY >= SIM_PARTICLE_WORST_CASE, "Parçacık havuzu en kötü durumu karşılamalı");
+_Static_assert(NUM_OBSTACLES <= 65536, "Engel indeksleri uint16_t'ye sığmalı");
+
+// === Rastgele sayı üreteci (PCG32, XSH RR) ===
+void SimRngSeed(SimRng *rng, uint64_t seed, uint64_t stream) {
+    rng->state = 0u;
+    rng->inc = (stream << 1u) | 1u;
+    SimRngNext(rng);
+    rng->state += seed;
+    SimRngNext(rng);
+}
+
+uint32_t SimRngNext(SimRng *rng) {
+    uint64_t oldState = rng->state;
+    rng->state = oldState * 6364136223846793005ULL + rng->inc;
+    uint32_t xorShifted = (uint32_t)(((oldState >> 18u) ^ oldState) >> 27u);
+    uint32_t rot = (uint32_t)(oldState >> 59u);
+    return (xorShifted >> rot) | (xorShifted << ((-rot) & 31));
+}
+
+int SimRngRange(SimRng *rng, int min, int max) {
+    if (max < min) {
+        int tmp = min;
+        min = max;
+        max = tmp;
+    }
+
+    uint64_t range = (uint64_t)((int64_t)max - min) + 1u;
+    return min + (int)(((uint64_t)SimRngNext(rng) * range) >> 32);
+}
+
+// === Patlamalar ===
+// Parçacıklar doğduktan sonra hiç güncellenmez (bkz. SimEvalParticles); burada
+// yalnızca patlamaların süreleri tutulur.
+static void InitExplosion(GameWorld *world, Vector2 position) {
+    world->explosionActive = true;
+    world->explosionDuration = 0.0f;
+    SimEmitParticles(&world->particles, &world->rng, EMITTER_CORE, position, world->levelTime);
+}
+
+static unsigned int UpdateExplosion(GameWorld *world, float dt) {
+    if (!world->explosionActive) return 0;
+
+    world->explosionDuration += dt;
+
+    if (world->explosionDuration >= CORE_EXPLOSION_DURATION) {
+        world->explosionActive = false;
+        return SIM_EVENT_EXPLOSION_FINISHED;
+    }
+
+    return 0;
+}
+
+// Çizim için: [0, count) parçacıklarının time anındaki konumu ve alfası
+void SimParticlesAt(const ParticleSet *particles, float time, float *x, float *y, float *alpha) {
+    SimParticleSpan span = SimLiveParticles(particles);
+    SimEvalParticles(&span, time, x, y, alpha);
+}
+
+// Beyaz top yandığında görsel işler; oyun tarafı SimTickDestroyCore'dadır
+static void BurnCore(GameWorld *world, Vector2 position) {
+    world->burned = true;
+    world->burnTimer = 0.0f;
+    world->trailActive = false;
+
+    for (int t = 0; t < TRAIL_LENGTH; t++) {
+        world->trail[t] = (Vector2){ -1000, -1000 };
+    }
+
+    InitExplosion(world, position);
+}
+
+// Engeli index'e yerleştirir ve türünün dizisine ekler. Levellerde indeks
+// sırasıyla çağrılır; türlerin dizileri böylece engel indeks sırasında kalır.
+static void PlaceLaser(GameWorld *world, int index, Vector2 position, float angle) {
+    LaserSet *lasers = &world->lasers;
+    int k = lasers->count++;
+
+    world->obstacles[index] = (Obstacle){ position, 20, true, false, 0.0f, OBSTACLE_LASER, k };
+    lasers->obstacle[k] = (uint16_t)index;
+    lasers->baseDirection[k] = SimLaserDirection(angle);
+    lasers->direction[k] = lasers->baseDirection[k];
+}
+
+static void PlaceShooter(GameWorld *world, int index, Vector2 position, float shootInterval) {
+    ShooterSet *shooters = &world->shooters;
+    int k = shooters->count++;
+
+    // Ateş topu havuzu (MAX_FIREBALLS) en kısa bu aralığa göre boyutlanır
+    if (shootInterval < MIN_SHOOT_INTERVAL) shootInterval = MIN_SHOOT_INTERVAL;
+
+    world->obstacles[index] = (Obstacle){ position, 20, true, false, 0.0f, OBSTACLE_SHOOTER, k };
+    shooters->obstacle[k] = (uint16_t)index;
+    shooters->shootTimer[k] = 0.0f;
+    shooters->shootInterval[k] = shootInterval;
+}
+
+// Level ayarlama fonksiyonu
+void SetupLevel(GameWorld *world, int level) {
+    Obstacle *obstacles = world->obstacles;
+    DeadlyWall *deadlyWalls = world->deadlyWalls;
+
+    world->level = level;
+
+    // Tüm engelleri deaktive et
+    for (int i = 0; i < NUM_OBSTACLES; i++) {
+        obstacles[i] = (Obstacle){ .active = false, .exploding = false, .kindIndex = -1 };
+    }
+    world->lasers.count = 0;
+    world->shooters.count = 0;
+
+    // Tüm ateş toplarını deaktive et
+    memset(world->fireballs.active, 0, sizeof(world->fireballs.active));
+    memset(world->fireballSlots, 0, sizeof(world->fireballSlots));
+
+    // Ölümcül duvarları deaktive et
+    for (int i = 0; i < MAX_DEADLY_WALLS; i++) {
+        deadlyWalls[i].active = false;
+    }
+
+    if (level == 0) {
+        // Level 1: 4 lazer engel
+        PlaceLaser(world, 0, (Vector2){ 367, 204 }, 0.0f);
+        PlaceLaser(world, 1, (Vector2){ 1103, 186 }, 90.0f);
+        PlaceLaser(world, 2, (Vector2){ 459, 577 }, 180.0f);
+        PlaceLaser(world, 3, (Vector2){ 1011, 569 }, 270.0f);
+    }
+    else if (level == 1) {
+        // Level 2: 4 lazer engel + 4 ateş topu fırlatan engel
+        PlaceLaser(world, 0, (Vector2){ 276, 204 }, 0.0f);
+        PlaceLaser(world, 1, (Vector2){ 1194, 204 }, 90.0f);
+        PlaceLaser(world, 2, (Vector2){ 276, 613 }, 180.0f);
+        PlaceLaser(world, 3, (Vector2){ 1194, 613 }, 270.0f);
+
+        // Ateş topu fırlatan engeller
+        PlaceShooter(world, 4, (Vector2){ 735, 136 }, 2.0f);
+        PlaceShooter(world, 5, (Vector2){ 184, 409 }, 2.5f);
+        PlaceShooter(world, 6, (Vector2){ 1286, 409 }, 2.2f);
+        PlaceShooter(world, 7, (Vector2){ 735, 681 }, 2.7f);
+    }
+    else if (level == 2) {
+        // Level 3: Daha zor bir kombinasyon
+        PlaceLaser(world, 0, (Vector2){ 367, 176 }, 45.0f);
+        PlaceLaser(world, 1, (Vector2){ 1103, 176 }, 135.0f);
+        PlaceLaser(world, 2, (Vector2){ 367, 611 }, 225.0f);
+        PlaceLaser(world, 3, (Vector2){ 1103, 611 }, 315.0f);
+
+        // Ateş topu fırlatan engeller (daha kısa ateşleme aralıkları)
+        PlaceShooter(world, 4, (Vector2){ 735, 204 }, 1.8f);
+        PlaceShooter(world, 5, (Vector2){ 367, 409 }, 1.5f);
+        PlaceShooter(world, 6, (Vector2){ 1103, 409 }, 1.7f);
+        PlaceShooter(world, 7, (Vector2){ 735, 613 }, 1.6f);
+
+        // Ölümcül duvarlar
+        deadlyWalls[0].startPos = (Vector2){ 367, 409 };
+        deadlyWalls[0].endPos = (Vector2){ 735, 613 };
+        deadlyWalls[0].thickness = 3.0f;
+        deadlyWalls[0].active = true;
+
+        deadlyWalls[1].startPos = (Vector2){ 1103, 409  };
+        deadlyWalls[1].endPos = (Vector2){ 735, 204 };
+        deadlyWalls[1].thickness = 3.0f;
+        deadlyWalls[1].active = true;
+    }
+    else if (level == 3) {
+        // Level 4: Level 3'ün aynısı + 8 ölümcül duvar
+
+        // Level 3'ün lazer engelleri
+        PlaceLaser(world, 0, (Vector2){ 367, 176 }, 45.0f);
+        PlaceLaser(world, 1, (Vector2){ 1103, 176 }, 135.0f);
+        PlaceLaser(world, 2, (Vector2){ 367, 611 }, 225.0f);
+        PlaceLaser(world, 3, (Vector2){ 1103, 611 }, 315.0f);
+
+        // Level 3'ün shooter engelleri
+        PlaceShooter(world, 4, (Vector2){ 735, 204 }, 1.8f);
+        PlaceShooter(world, 5, (Vector2){ 367, 409 }, 1.5f);
+        PlaceShooter(world, 6, (Vector2){ 1103, 409 }, 1.7f);
+        PlaceShooter(world, 7, (Vector2){ 735, 613 }, 1.6f);
+
+        // Level 3'ün eski 2 ölümcül duvarı
+        deadlyWalls[0].startPos = (Vector2){ 367, 409 };
+        deadlyWalls[0].endPos = (Vector2){ 735, 613 };
+        deadlyWalls[0].thickness = 3.0f;
+        deadlyWalls[0].active = true;
+
+        deadlyWalls[1].startPos = (Vector2){ 1103, 409 };
+        deadlyWalls[1].endPos = (Vector2){ 735, 204 };
+        deadlyWalls[1].thickness = 3.0f;
+        deadlyWalls[1].active = true;
+
+        // Yeni 8 ölümcül duvar
+        deadlyWalls[2].startPos = (Vector2){ 367, 176 };
+        deadlyWalls[2].endPos = (Vector2){ 120, 409 };
+        deadlyWalls[2].thickness = 3.0f;
+        deadlyWalls[2].active = true;
+
+        deadlyWalls[3].startPos = (Vector2){ 367, 611 };
+        deadlyWalls[3].endPos = (Vector2){ 120, 409 };
+        deadlyWalls[3].thickness = 3.0f;
+        deadlyWalls[3].active = true;
+
+        deadlyWalls[4].startPos = (Vector2){ 1103, 176 };
+        deadlyWalls[4].endPos = (Vector2){ 1300, 409 };
+        deadlyWalls[4].thickness = 3.0f;
+        deadlyWalls[4].active = true;
+
+        deadlyWalls[5].startPos = (Vector2){ 1103, 611 };
+        deadlyWalls[5].endPos = (Vector2){ 1300, 409 };
+        deadlyWalls[5].thickness = 3.0f;
+        deadlyWalls[5].active = true;
+
+        deadlyWalls[6].startPos = (Vector2){ 367, 611 };
+        deadlyWalls[6].endPos = (Vector2){ 735, 750 };
+        deadlyWalls[6].thickness = 3.0f;
+        deadlyWalls[6].active = true;
+
+        deadlyWalls[7].startPos = (Vector2){ 1103, 611 };
+        deadlyWalls[7].endPos = (Vector2){ 735, 750 };
+        deadlyWalls[7].thickness = 3.0f;
+        deadlyWalls[7].active = true;
+
+        // 7. duvar
+        deadlyWalls[8].startPos = (Vector2){ 367, 176 };
+        deadlyWalls[8].endPos = (Vector2){ 735, 60 };
+        deadlyWalls[8].thickness = 3.0f;
+        deadlyWalls[8].active = true;
+
+        // 8. duvar
+        deadlyWalls[9].startPos = (Vector2){ 1103, 176 };
+        deadlyWalls[9].endPos = (Vector2){ 735, 60 };
+        deadlyWalls[9].thickness = 3.0f;
+        deadlyWalls[9].active = true;
+    }
+else if (level == 4) {
+    // Level 5: Level 4'ün aynısı + kesişim noktalarında shooter engeller
+
+    // Level 3'ün lazer engelleri
+        PlaceLaser(world, 0, (Vector2){ 367, 176 }, 45.0f);
+        PlaceLaser(world, 1, (Vector2){ 1103, 176 }, 135.0f);
+        PlaceLaser(world, 2, (Vector2){ 367, 611 }, 225.0f);
+        PlaceLaser(world, 3, (Vector2){ 1103, 611 }, 315.0f);
+
+        // Level 3'ün shooter engelleri
+        PlaceShooter(world, 4, (Vector2){ 735, 204 }, 1.8f);
+        PlaceShooter(world, 5, (Vector2){ 367, 409 }, 1.5f);
+        PlaceShooter(world, 6, (Vector2){ 1103, 409 }, 1.7f);
+        PlaceShooter(world, 7, (Vector2){ 735, 613 }, 1.6f);
+
+        // Level 3'ün eski 2 ölümcül duvarı
+        deadlyWalls[0].startPos = (Vector2){ 367, 409 };
+        deadlyWalls[0].endPos = (Vector2){ 735, 613 };
+        deadlyWalls[0].thickness = 3.0f;
+        deadlyWalls[0].active = true;
+
+        deadlyWalls[1].startPos = (Vector2){ 1103, 409 };
+        deadlyWalls[1].endPos = (Vector2){ 735, 204 };
+        deadlyWalls[1].thickness = 3.0f;
+        deadlyWalls[1].active = true;
+
+        // Yeni 8 ölümcül duvar
+        deadlyWalls[2].startPos = (Vector2){ 367, 176 };
+        deadlyWalls[2].endPos = (Vector2){ 120, 409 };
+        deadlyWalls[2].thickness = 3.0f;
+        deadlyWalls[2].active = true;
+
+        deadlyWalls[3].startPos = (Vector2){ 367, 611 };
+        deadlyWalls[3].endPos = (Vector2){ 120, 409 };
+        deadlyWalls[3].thickness = 3.0f;
+        deadlyWalls[3].active = true;
+
+        deadlyWalls[4].startPos = (Vector2){ 1103, 176 };
+        deadlyWalls[4].endPos = (Vector2){ 1300, 409 };
+        deadlyWalls[4].thickness = 3.0f;
+        deadlyWalls[4].active = true;
+
+        deadlyWalls[5].startPos = (Vector2){ 1103, 611 };
+        deadlyWalls[5].endPos = (Vector2){ 1300, 409 };
+        deadlyWalls[5].thickness = 3.0f;
+        deadlyWalls[5].active = true;
+
+        deadlyWalls[6].startPos = (Vector2){ 367, 611 };
+        deadlyWalls[6].endPos = (Vector2){ 735, 750 };
+        deadlyWalls[6].thickness = 3.0f;
+        deadlyWalls[6].active = true;
+
+        deadlyWalls[7].startPos = (Vector2){ 1103, 611 };
+        deadlyWalls[7].endPos = (Vector2){ 735, 750 };
+        deadlyWalls[7].thickness = 3.0f;
+        deadlyWalls[7].active = true;
+
+        // 7. duvar
+        deadlyWalls[8].startPos = (Vector2){ 367, 176 };
+        deadlyWalls[8].endPos = (Vector2){ 735, 60 };
+        deadlyWalls[8].thickness = 3.0f;
+        deadlyWalls[8].active = true;
+
+        // 8. duvar
+        deadlyWalls[9].startPos = (Vector2){ 1103, 176 };
+        deadlyWalls[9].endPos = (Vector2){ 735, 60 };
+        deadlyWalls[9].thickness = 3.0f;
+        deadlyWalls[9].active = true;
+
+        PlaceShooter(world, 8, (Vector2){ 120, 409 }, 4.8f);
+        PlaceShooter(world, 9, (Vector2){ 1300, 409 }, 4.5f);
+        PlaceShooter(world, 10, (Vector2){ 735, 750 }, 4.7f);
+        PlaceShooter(world, 11, (Vector2){ 735, 60 }, 4.6f);
+    // Kesişim noktalarında ek shooter engeller (mevcut obstacle dizisinde boş yer yoksa NUM_OBSTACLES'ı artırın)
+    // Bu engelleri obstacles dizisinin sonuna ekleyin
+    }
+
+
+    // Ateş topu havuzu leveldeki shooter'ların aynı anda havada tutabileceği kadardır;
+    // her shooter en fazla MAX_SHOOTER_FIREBALLS tuttuğundan MAX_FIREBALLS'a sığar ve
+    // atış hiç düşmez. Boş slot bulmak bit işlemi, güncelleme yalnızca aktif slotları gezer
+    world->fireballCapacity = 0;
+    for (int k = 0; k < world->shooters.count; k++) {
+        world->fireballCapacity += SimShooterFireballBound(world->shooters.shootInterval[k]);
+    }
+
+    // Lazer açıları level başındaki açıdan (PlaceLaser) kapalı biçimde hesaplanır
+    world->laserPhase = 0;
+
+    // Patlama parçacıklarını sıfırla
+    world->particles.count = 0;
+
+    SimIndexObstacles(world);
+
+    // Engeller ve duvarlar level boyunca sabit; çarpışma ızgarası ve duvar tablosu bir kez kurulur
+    SimBuildWallSegments(&world->wallSegments, deadlyWalls, MAX_DEADLY_WALLS, world->coreRadius);
+    SimGridBuild(&world->grid, obstacles, NUM_OBSTACLES, deadlyWalls, MAX_DEADLY_WALLS,
+                 world->screenWidth, world->screenHeight, world->coreRadius);
+
+    // Duvarların uzaklık alanı level başına bir kez çözülür (flaming_sdf.h); tick'ler slotu okur
+    world->sdfSlot = SimLevelSdfSlot(world);
+}
+
+void SimInitWorld(GameWorld *world, int level, float screenWidth, float screenHeight, uint64_t seed) {
+    memset(world, 0, sizeof(*world));
+
+    world->seed = seed;
+    SimRngSeed(&world->rng, seed, SIM_RNG_STREAM_WORLD);
+
+    world->screenWidth = screenWidth;
+    world->screenHeight = screenHeight;
+    world->corePosition = (Vector2){ screenWidth / 2.0f, screenHeight / 2.0f };
+    world->velocity = (Vector2){ 0.0f, 0.0f };
+    world->coreRadius = CORE_RADIUS;
+    world->gameOver = false;
+    world->victory = false;
+    world->burned = false;
+    world->burnTimer = 0.0f;
+    world->aiming = false;
+    world->timeScale = 1.0f;
+    world->trailIndex = 0;
+    world->trailActive = true;
+    world->explosionActive = false;
+    world->bulletTimeActive = false;
+    world->trailTimer = 0.0f;
+    world->tick = 0;
+    world->levelTime = 0.0f;
+    world->completionTime = 0.0f;
+
+    // Trail'i temizle
+    for (int i = 0; i < TRAIL_LENGTH; i++) {
+        world->trail[i] = (Vector2){ -1000, -1000 };
+    }
+
+    // Level ayarlamalarını yap
+    SetupLevel(world, level);
+}
+
+int SimActiveObstacleCount(const GameWorld *world) {
+    return world->aliveObstacles + world->explodingObstacles;
+}
+
+void SimIndexObstacles(GameWorld *world) {
+    const Obstacle *obstacles = world->obstacles;
+    uint16_t *order = world->obstacleOrder;
+    int count = 0;
+
+    for (int i = 0; i < NUM_OBSTACLES; i++) {
+        if (obstacles[i].active && !obstacles[i].exploding) order[count++] = (uint16_t)i;
+    }
+    world->aliveObstacles = count;
+
+    for (int i = 0; i < NUM_OBSTACLES; i++) {
+        if (obstacles[i].exploding) order[count++] = (uint16_t)i;
+    }
+    world->explodingObstacles = count - world->aliveObstacles;
+
+    for (int i = 0; i < NUM_OBSTACLES; i++) {
+        if (!obstacles[i].active && !obstacles[i].exploding) order[count++] = (uint16_t)i;
+    }
+
+    LaserSet *lasers = &world->lasers;
+    lasers->aliveCount = 0;
+    for (int k = 0; k < lasers->count; k++) {
+        const Obstacle *obstacle = &obstacles[lasers->obstacle[k]];
+        if (obstacle->active && !obstacle->exploding) lasers->alive[lasers->aliveCount++] = (uint16_t)k;
+    }
+
+    ShooterSet *shooters = &world->shooters;
+    shooters->aliveCount = 0;
+    for (int k = 0; k < shooters->count; k++) {
+        const Obstacle *obstacle = &obstacles[shooters->obstacle[k]];
+        if (obstacle->active && !obstacle->exploding) shooters->alive[shooters->aliveCount++] = (uint16_t)k;
+    }
+}
+
+// === Anlık görüntü ===
+void SaveWorldState(const GameWorld *world, WorldState *state) {
+    state->magic = WORLD_STATE_MAGIC;
+    state->size = (uint32_t)sizeof(GameWorld);
+    memcpy(&state->world, world, sizeof(GameWorld));
+}
+
+bool LoadWorldState(GameWorld *world, const WorldState *state) {
+    if (state->magic != WORLD_STATE_MAGIC || state->size != sizeof(GameWorld)) return false;
+
+    memcpy(world, &state->world, sizeof(GameWorld));
+
+    // Uzaklık alanının slotu bu sürecin önbelleğine aittir; blob başka yerden gelmiş olabilir
+    world->sdfSlot = SimLevelSdfSlot(world);
+    return true;
+}
+
+// === Durum özeti ===
+// Derleyicinin eklediği yapı boşlukları tanımsız olabildiğinden memcmp/hash tüm
+// yapı üzerinde değil, alan alan yapılır.
+#define FNV_OFFSET_BASIS 14695981039346656037ULL
+#define FNV_PRIME 1099511628211ULL
+
+static uint64_t HashBytes(uint64_t hash, const void *data, size_t size) {
+    const unsigned char *bytes = data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+static uint64_t HashFloat(uint64_t hash, float value) {
+    return HashBytes(hash, &value, sizeof(value));
+}
+
+static uint64_t HashInt(uint64_t hash, int value) {
+    return HashBytes(hash, &value, sizeof(value));
+}
+
+static uint64_t HashBool(uint64_t hash, bool value) {
+    unsigned char byte = value ? 1 : 0;
+    return HashBytes(hash, &byte, 1);
+}
+
+static uint64_t HashVector(uint64_t hash, Vector2 value) {
+    return HashFloat(HashFloat(hash, value.x), value.y);
+}
+
+static uint64_t HashParticle(uint64_t hash, const ParticleSet *particles, int i) {
+    hash = HashVector(hash, (Vector2){ particles->originX[i], particles->originY[i] });
+    hash = HashVector(hash, (Vector2){ particles->velocityX[i], particles->velocityY[i] });
+    hash = HashFloat(hash, particles->spawnTime[i]);
+    hash = HashFloat(hash, particles->lifetime[i]);
+    hash = HashFloat(hash, particles->radius[i]);
+    hash = HashBytes(hash, &particles->palette[i], 1);
+    return HashBytes(hash, &particles->shade[i], 1);
+}
+
+uint64_t SimWorldHash(const GameWorld *world) {
+    uint64_t hash = FNV_OFFSET_BASIS;
+
+    hash = HashInt(hash, world->level);
+    hash = HashBytes(hash, &world->seed, sizeof(world->seed));
+    hash = HashBytes(hash, &world->rng.state, sizeof(world->rng.state));
+    hash = HashBytes(hash, &world->rng.inc, sizeof(world->rng.inc));
+    hash = HashFloat(hash, world->screenWidth);
+    hash = HashFloat(hash, world->screenHeight);
+
+    hash = HashVector(hash, world->corePosition);
+    hash = HashVector(hash, world->velocity);
+    hash = HashFloat(hash, world->coreRadius);
+    hash = HashBool(hash, world->gameOver);
+    hash = HashBool(hash, world->victory);
+    hash = HashBool(hash, world->burned);
+    hash = HashFloat(hash, world->burnTimer);
+    hash = HashBool(hash, world->aiming);
+    hash = HashVector(hash, world->targetPosition);
+    hash = HashFloat(hash, world->timeScale);
+    hash = HashBool(hash, world->bulletTimeActive);
+
+    for (int i = 0; i < TRAIL_LENGTH; i++) hash = HashVector(hash, world->trail[i]);
+    hash = HashInt(hash, world->trailIndex);
+    hash = HashBool(hash, world->trailActive);
+    hash = HashFloat(hash, world->trailTimer);
+
+    for (int i = 0; i < NUM_OBSTACLES; i++) {
+        const Obstacle *obstacle = &world->obstacles[i];
+        hash = HashVector(hash, obstacle->position);
+        hash = HashFloat(hash, obstacle->radius);
+        hash = HashBool(hash, obstacle->active);
+        hash = HashBool(hash, obstacle->exploding);
+        hash = HashFloat(hash, obstacle->explosionTimer);
+        hash = HashInt(hash, (int)obstacle->type);
+        hash = HashInt(hash, obstacle->kindIndex);
+    }
+
+    const LaserSet *lasers = &world->lasers;
+    hash = HashInt(hash, lasers->count);
+    for (int k = 0; k < lasers->count; k++) {
+        hash = HashInt(hash, lasers->obstacle[k]);
+        hash = HashVector(hash, lasers->baseDirection[k]);
+        hash = HashVector(hash, lasers->direction[k]);
+    }
+    hash = HashInt(hash, lasers->aliveCount);
+
+    const ShooterSet *shooters = &world->shooters;
+    hash = HashInt(hash, shooters->count);
+    for (int k = 0; k < shooters->count; k++) {
+        hash = HashInt(hash, shooters->obstacle[k]);
+        hash = HashFloat(hash, shooters->shootTimer[k]);
+        hash = HashFloat(hash, shooters->shootInterval[k]);
+    }
+    hash = HashInt(hash, shooters->aliveCount);
+    hash = HashInt(hash, world->aliveObstacles);
+    hash = HashInt(hash, world->explodingObstacles);
+    hash = HashBytes(hash, &world->laserPhase, sizeof(world->laserPhase));
+
+    for (int i = 0; i < MAX_FIREBALLS; i++) {
+        const FireballSet *fireballs = &world->fireballs;
+        hash = HashVector(hash, (Vector2){ fireballs->x[i], fireballs->y[i] });
+        hash = HashVector(hash, (Vector2){ fireballs->velocityX[i], fireballs->velocityY[i] });
+        hash = HashFloat(hash, fireballs->radius[i]);
+        hash = HashBool(hash, fireballs->active[i]);
+        hash = HashFloat(hash, fireballs->lifeTime[i]);
+    }
+    hash = HashBytes(hash, world->fireballSlots, sizeof(world->fireballSlots));
+    hash = HashInt(hash, world->fireballCapacity);
+
+    for (int i = 0; i < MAX_DEADLY_WALLS; i++) {
+        const DeadlyWall *wall = &world->deadlyWalls[i];
+        hash = HashVector(hash, wall->startPos);
+        hash = HashVector(hash, wall->endPos);
+        hash = HashFloat(hash, wall->thickness);
+        hash = HashBool(hash, wall->active);
+    }
+    // sdfSlot bu sürecin önbelleğindeki yerdir, simülasyon durumu değildir
+
+    hash = HashBool(hash, world->explosionActive);
+    hash = HashFloat(hash, world->explosionDuration);
+    hash = HashInt(hash, world->particles.count);
+    for (int i = 0; i < world->particles.count; i++) {
+        hash = HashParticle(hash, &world->particles, i);
+    }
+
+    hash = HashInt(hash, world->tick);
+    hash = HashFloat(hash, world->levelTime);
+    hash = HashFloat(hash, world->completionTime);
+
+    return hash;
+}
+
+// === Tick ===
+static void LoadTickState(GameWorld *world, SimTickState *state) {
+    *state = (SimTickState){
+        .tick = world->tick,
+        .levelTime = world->levelTime,
+        .completionTime = world->completionTime,
+        .corePosition = world->corePosition,
+        .velocity = world->velocity,
+        .targetPosition = world->targetPosition,
+        .timeScale = world->timeScale,
+        .aiming = world->aiming,
+        .bulletTimeActive = world->bulletTimeActive,
+        .gameOver = world->gameOver,
+        .victory = world->victory,
+        .laserPhase = world->laserPhase,
+        .obstacles = world->obstacles,
+        .obstacleOrder = world->obstacleOrder,
+        .aliveObstacles = world->aliveObstacles,
+        .explodingObstacles = world->explodingObstacles,
+        .lasers = &world->lasers,
+        .shooters = &world->shooters,
+        .fireballs = &world->fireballs,
+        .fireballSlots = world->fireballSlots,
+        .fireballCapacity = world->fireballCapacity
+    };
+}
+
+static void StoreTickState(GameWorld *world, const SimTickState *state) {
+    world->tick = state->tick;
+    world->levelTime = state->levelTime;
+    world->completionTime = state->completionTime;
+    world->corePosition = state->corePosition;
+    world->velocity = state->velocity;
+    world->targetPosition = state->targetPosition;
+    world->timeScale = state->timeScale;
+    world->aiming = state->aiming;
+    world->bulletTimeActive = state->bulletTimeActive;
+    world->gameOver = state->gameOver;
+    world->victory = state->victory;
+    world->laserPhase = state->laserPhase;
+    world->aliveObstacles = state->aliveObstacles;
+    world->explodingObstacles = state->explodingObstacles;
+}
+
+// Oyunun kendisi flaming_rules.h'deki ortak gövdededir; burada görsel işler,
+// gövdenin bildirdiklerinden eski sıralarıyla yapılır
+unsigned int SimStep(GameWorld *world, const SimInput *input, float dt) {
+    SimTickState state;
+    LoadTickState(world, &state);
+
+    if (!SimTickBegin(&state, input, dt)) {
+        StoreTickState(world, &state);
+        return 0;
+    }
+
+    // Patlama efekti varsa sadece patlamayı güncelle
+    if (world->explosionActive) {
+        StoreTickState(world, &state);
+        return UpdateExplosion(world, dt);
+    }
+
+    // SimStep skaler çekirdekleri kullanır; vektör sürümleriyle sonuç bit bit aynıdır.
+    // Duvarlar yalnızca level 3'ten itibaren ölümcüldür.
+    SimTickLevel level = {
+        &world->grid, (world->level >= 2) ? &world->wallSegments : NULL, SimWorldSdf(world),
+        SimFireballKernel(SIM_SIMD_SCALAR), NULL, world->coreRadius, world->screenWidth, world->screenHeight
+    };
+    SimTickResult result;
+    SimTickRun(&state, &level, input, dt, &result);
+    StoreTickState(world, &state);
+
+    if (!result.moved) {
+        if (result.events & SIM_EVENT_CORE_DESTROYED) BurnCore(world, result.burnPosition);
+        if (world->burned && !world->explosionActive) world->burnTimer += dt;
+        return result.events;
+    }
+
+    // Trail güncelleme (tick hızından bağımsız olarak sabit aralıklarla); yanan
+    // top yandığı yerde örneklenir
+    bool burned = (result.events & SIM_EVENT_CORE_DESTROYED) != 0;
+    world->trailTimer += dt;
+    if (world->trailActive && world->trailTimer >= TRAIL_SAMPLE_INTERVAL) {
+        world->trailTimer -= TRAIL_SAMPLE_INTERVAL;
+        world->trail[world->trailIndex] = burned ? result.burnPosition : world->corePosition;
+        world->trailIndex = (world->trailIndex + 1) % TRAIL_LENGTH;
+    }
+
+    // Engel tipine göre farklı patlama renkleri
+    for (int h = 0; h < result.hitCount; h++) {
+        const Obstacle *obstacle = &world->obstacles[result.hits[h]];
+        EmitterType emitter = (obstacle->type == OBSTACLE_SHOOTER) ? EMITTER_SHOOTER : EMITTER_LASER;
+        SimEmitParticles(&world->particles, &world->rng, emitter, obstacle->position, world->levelTime);
+    }
+
+    if (burned) BurnCore(world, result.burnPosition);
+
+    if (result.events & SIM_EVENT_LEVEL_COMPLETED) {
+        for (int i = 0; i < TRAIL_LENGTH; i++) {
+            world->trail[i] = world->trail[world->trailIndex];
+        }
+
+        world->trailActive = false;
+    }
+
+    return result.events;
+}
@@ -0,0 +1,278 @@
+#ifndef FLAMING_SIM_H
+#define FLAMING_SIM_H
+
+// Flaming Core simülasyon çekirdeği: pencere, ses ve girdi API'lerinden bağımsızdır.
+// Oyun (62_flaming_core.c) ve ekransız araçlar aynı SimStep'i çağırır.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// raylib.h ile aynı düzen; hangisi önce dahil edilirse onun tanımı kullanılır
+#if !defined(RL_VECTOR2_TYPE)
+typedef struct Vector2 {
+    float x;
+    float y;
+} Vector2;
+#define RL_VECTOR2_TYPE
+#endif
+
+// === Sabitler ve Yapılar ===
+#define MAX_LEVELS 5
+#define TRAIL_LENGTH 18
+#define NUM_OBSTACLES 12
+#define LASER_LENGTH 150
+#define LASER_THICKNESS 13
+#define EXPLOSION_PARTICLES 20
+#define OBSTACLE_EXPLOSION_PARTICLES 15
+#define BULLET_TIME_SCALE 0.1f
+#define MIN_SHOOT_INTERVAL 1.0f  // PlaceShooter daha kısa atış aralığını buna yükseltir
+#define MAX_SHOOTER_FIREBALLS 7  // SimShooterFireballBound(MIN_SHOOT_INTERVAL)
+#define MAX_FIREBALLS (NUM_OBSTACLES * MAX_SHOOTER_FIREBALLS)  // Her engel shooter olsa da havuz dolmaz
+#define SIM_FIREBALL_WORDS ((MAX_FIREBALLS + 63) / 64)  // GameWorld::fireballSlots
+#define MAX_DEADLY_WALLS 10
+
+// Sabit adımlı simülasyon: her SimStep bir tick ilerletir
+#define SIM_TICK_RATE 240
+#define SIM_DT (1.0f / SIM_TICK_RATE)
+#define TRAIL_SAMPLE_INTERVAL (1.0f / 60.0f)  // Trail tick hızından bağımsız 60 Hz örneklenir
+
+// SimStep'in döndürdüğü olay bayrakları (ses ve ekran geçişleri oyun tarafında yapılır)
+#define SIM_EVENT_OBSTACLE_DESTROYED   0x01
+#define SIM_EVENT_CORE_DESTROYED       0x02
+#define SIM_EVENT_LEVEL_COMPLETED      0x04
+#define SIM_EVENT_EXPLOSION_FINISHED   0x08
+
+typedef enum {
+    OBSTACLE_LASER,
+    OBSTACLE_SHOOTER,
+    OBSTACLE_DEADLY_WALL
+} ObstacleType;
+
+// Patlama parçacıklarının renk paleti; gerçek renkler çizim tarafında seçilir
+typedef enum {
+    PALETTE_CORE,
+    PALETTE_SHOOTER,
+    PALETTE_LASER,
+    PALETTE_FLAME  // Ateş toplarının alevleri; yalnızca çizim kullanır
+} ParticlePalette;
+
+typedef struct {
+    Vector2 startPos;
+    Vector2 endPos;
+    float thickness;
+    bool active;
+} DeadlyWall;
+
+// Tüm engel türlerinin ortak alanları: çarpışma, durum ve patlama. Türe özgü
+// alanlar türün kendi dizisindedir (GameWorld.lasers, GameWorld.shooters);
+// kindIndex engelin oradaki yeridir, levelde olmayan slotta -1.
+typedef struct {
+    Vector2 position;
+    float radius;
+    bool active;
+    bool exploding;
+    float explosionTimer;
+    ObstacleType type;
+    int kindIndex;
+} Obstacle;
+
+// Lazer engelleri (SoA), engel indeks sırasında. alive[0, aliveCount) yaşayan
+// (aktif ve patlamayan) lazerlerin bu dizilerdeki yerleridir, yine engel indeks
+// sırasında; çarpışma ve çizim döngüleri yalnızca onları gezer.
+typedef struct {
+    int count;
+    uint16_t obstacle[NUM_OBSTACLES];  // GameWorld.obstacles'taki indeks
+    Vector2 baseDirection[NUM_OBSTACLES];  // Level başındaki yön (birim vektör)
+    Vector2 direction[NUM_OBSTACLES];  // baseDirection, GameWorld.laserPhase'in açısıyla döndürülür
+    int aliveCount;
+    uint16_t alive[NUM_OBSTACLES];
+} LaserSet;
+
+// Ateş topu fırlatan engeller (SoA), engel indeks sırasında; aynı tick'te
+// ateşleyenlerin slot sırası buna bağlıdır. alive LaserSet'teki gibi.
+typedef struct {
+    int count;
+    uint16_t obstacle[NUM_OBSTACLES];  // GameWorld.obstacles'taki indeks
+    float shootTimer[NUM_OBSTACLES];
+    float shootInterval[NUM_OBSTACLES];
+    int aliveCount;
+    uint16_t alive[NUM_OBSTACLES];
+} ShooterSet;
+
+// Patlama parçacıkları: tüm patlamaların paylaştığı havuz (SoA). Parçacıklar
+// [0, count) aralığında sıkışık durur. Her parçacık doğarken bir kez yazılır;
+// konumu ve alfası çizimde doğum anından kapalı formda hesaplanır
+// (SimEvalParticles). Ömrü dolanlar yeni parçacıklar doğarken havuzdan çıkarılır;
+// sönmüş ama henüz çıkarılmamış parçacık çizilmez. Hangi patlamanın kaç
+// parçacık çıkardığı flaming_rules.h'deki yayıcı (emitter) tablosundadır.
+//
+// Havuz level başında boşalır ve bir levelde top bir kez, her engel en fazla bir
+// kez patlar; kapasite bu en kötü durumu (tablodaki sayılarla) karşılar, yani
+// hiçbir parçacık atılmaz.
+#define SIM_PARTICLE_LANES 8  // SimEvalParticles'ın blok boyu; kapasite bunun katıdır
+#define SIM_PARTICLE_WORST_CASE (EXPLOSION_PARTICLES + NUM_OBSTACLES * OBSTACLE_EXPLOSION_PARTICLES)
+#define SIM_PARTICLE_CAPACITY \
+    ((SIM_PARTICLE_WORST_CASE + SIM_PARTICLE_LANES - 1) / SIM_PARTICLE_LANES * SIM_PARTICLE_LANES)
+
+typedef struct {
+    int count;
+
+    // Hareket
+    float originX[SIM_PARTICLE_CAPACITY];
+    float originY[SIM_PARTICLE_CAPACITY];
+    float velocityX[SIM_PARTICLE_CAPACITY];
+    float velocityY[SIM_PARTICLE_CAPACITY];
+    float spawnTime[SIM_PARTICLE_CAPACITY];  // Doğduğu andaki levelTime
+    float lifetime[SIM_PARTICLE_CAPACITY];   // Alfanın 1'den 0'a inme süresi
+
+    // Görünüş
+    float radius[SIM_PARTICLE_CAPACITY];
+    unsigned char palette[SIM_PARTICLE_CAPACITY];
+    unsigned char shade[SIM_PARTICLE_CAPACITY];  // Paletteki renk (0-2)
+} ParticleSet;
+
+// Ateş topları (SoA); batch motorunun dilimleriyle (SimFireballSpan) aynı düzen.
+// Güncelleme yalnızca sıcak dizileri okur; aktiflik GameWorld::fireballSlots'tadır.
+typedef struct {
+    // Sıcak
+    float x[MAX_FIREBALLS];
+    float y[MAX_FIREBALLS];
+    float velocityX[MAX_FIREBALLS];
+    float velocityY[MAX_FIREBALLS];
+    float lifeTime[MAX_FIREBALLS];
+
+    // Soğuk
+    float radius[MAX_FIREBALLS];
+    uint8_t active[MAX_FIREBALLS];
+} FireballSet;
+
+// PCG32 rastgele sayı üreteci; her dünya kendi durumunu taşır
+typedef struct {
+    uint64_t state;
+    uint64_t inc;  // Akış (stream) seçici, her zaman tek sayı
+} SimRng;
+
+// Statik engel ve duvarların düzgün ızgarası (flaming_grid.h)
+#define SIM_GRID_MIN_CELL_SIZE 64.0f
+#define SIM_GRID_MAX_COLS 24
+#define SIM_GRID_MAX_ROWS 16
+#define SIM_GRID_MAX_CELLS (SIM_GRID_MAX_COLS * SIM_GRID_MAX_ROWS)
+#define SIM_GRID_MAX_ENTRIES (64 * (NUM_OBSTACLES + MAX_DEADLY_WALLS))  // Sığmazsa hücreler büyütülür
+
+typedef struct {
+    int cols;
+    int rows;
+    float inverseCellSize;
+    uint32_t obstacleStart[SIM_GRID_MAX_CELLS + 1];  // Hücre c'nin engelleri: entries[obstacleStart[c], obstacleStart[c + 1])
+    uint32_t wallStart[SIM_GRID_MAX_CELLS + 1];
+    uint16_t entries[SIM_GRID_MAX_ENTRIES];
+} SimGrid;
+
+// Statik doğru parçaları (ölümcül duvarlar). SimPointNearLine'ın noktadan
+// bağımsız kısmı level kurulurken bir kez hesaplanır; SoA düzeni vektör
+// çekirdeklerinin (flaming_simd.h) doğrudan okuyabilmesi içindir.
+typedef struct {
+    int count;
+    float originX[MAX_DEADLY_WALLS];
+    float originY[MAX_DEADLY_WALLS];
+    float deltaX[MAX_DEADLY_WALLS];
+    float deltaY[MAX_DEADLY_WALLS];
+    float limit[MAX_DEADLY_WALLS];     // eşik * max(|deltaX|, |deltaY|)
+    float low[MAX_DEADLY_WALLS];       // Baskın eksendeki aralık
+    float high[MAX_DEADLY_WALLS];
+    int32_t axisMask[MAX_DEADLY_WALLS];  // -1: baskın eksen y, 0: x
+} SimSegmentTable;
+
+// Bir tick boyunca simülasyonun tükettiği girdiler
+typedef struct {
+    Vector2 aimTarget;       // Nişan alınan nokta (fare konumu)
+    bool aimDown;            // Sol tık basılı ve pause butonunun dışında
+    bool aimReleased;        // Sol tık bu tick bırakıldı
+    bool toggleBulletTime;   // SPACE basıldı
+    bool resumeFromPause;    // Pause ekranından devam edildi
+} SimInput;
+
+// Tek bir oyun dünyasının tüm simülasyon durumu
+typedef struct {
+    int level;
+    uint64_t seed;
+    SimRng rng;  // Yalnızca simülasyon kullanır; çizim kendi akışını kullanmalı
+    float screenWidth;
+    float screenHeight;
+
+    Vector2 corePosition;
+    Vector2 velocity;
+    float coreRadius;
+    bool gameOver;
+    bool victory;
+    bool burned;
+    float burnTimer;
+    bool aiming;
+    Vector2 targetPosition;
+    float timeScale;
+    bool bulletTimeActive;
+
+    Vector2 trail[TRAIL_LENGTH];
+    int trailIndex;
+    bool trailActive;
+    float trailTimer;
+
+    Obstacle obstacles[NUM_OBSTACLES];
+    // Engel indeksleri duruma göre sıkışık: [0, aliveObstacles) yaşayanlar (indeks
+    // sırasında; güncelleme sırası buna bağlı), ardından explodingObstacles kadar
+    // patlayan, kalanı ölü ya da levelde yok. Döngüler yalnızca ilgili kısmı gezer.
+    // active/exploding bayrakları ve türlerin alive listeleriyle birlikte
+    // flaming_sim.c günceller.
+    uint16_t obstacleOrder[NUM_OBSTACLES];
+    int aliveObstacles;
+    int explodingObstacles;
+    LaserSet lasers;
+    ShooterSet shooters;
+    uint32_t laserPhase;  // Lazerlerin level başından beri döndüğü adım (SimLaserTurnAt)
+    FireballSet fireballs;
+    uint64_t fireballSlots[SIM_FIREBALL_WORDS];  // Aktif ateş topları: bit i <=> fireballs.active[i]
+    int fireballCapacity;    // Kullanılan slotlar [0, fireballCapacity); SetupLevel shooter'lardan hesaplar
+    DeadlyWall deadlyWalls[MAX_DEADLY_WALLS];
+    SimGrid grid;  // SetupLevel kurar; engeller ve duvarlar değişirse yeniden kurulmalı
+    SimSegmentTable wallSegments;  // deadlyWalls ile aynı indeksler
+    int sdfSlot;  // Duvarların uzaklık alanı (SimWorldSdf); SetupLevel çözer, alan yoksa -1
+
+    bool explosionActive;
+    float explosionDuration;
+    ParticleSet particles;  // Beyaz topun ve engellerin patlama parçacıkları
+
+    int tick;              // Level başlangıcından beri işlenen tick sayısı
+    float levelTime;       // Level başlangıcından beri geçen süre
+    float completionTime;  // Level bittiğinde levelTime
+} GameWorld;
+
+// Dünyanın tamamının işaretçisiz kopyası; memcpy ile kaydedilip dosyaya da yazılabilir.
+// GameWorld işaretçi içermediği için (RNG dahil) tüm durum bu blob'dadır.
+#define WORLD_STATE_MAGIC 0x53574346u  // "FCWS"
+
+typedef struct {
+    uint32_t magic;
+    uint32_t size;  // sizeof(GameWorld); farklı derlemelerin blob'ları karışmasın
+    GameWorld world;
+} WorldState;
+
+// Rastgele sayı akışları (aynı seed'den bağımsız diziler üretir)
+#define SIM_RNG_STREAM_WORLD 1
+#define SIM_RNG_STREAM_RENDER 2
+
+// === Fonksiyon prototipleri ===
+void SimRngSeed(SimRng *rng, uint64_t seed, uint64_t stream);
+uint32_t SimRngNext(SimRng *rng);
+int SimRngRange(SimRng *rng, int min, int max);  // min ve max dahil
+
+void SimInitWorld(GameWorld *world, int level, float screenWidth, float screenHeight, uint64_t seed);
+void SetupLevel(GameWorld *world, int level);
+unsigned int SimStep(GameWorld *world, const SimInput *input, float dt);  // dt: tick süresi (SIM_DT)
+int SimActiveObstacleCount(const GameWorld *world);  // Yaşayan + patlayan
+void SimIndexObstacles(GameWorld *world);  // Durum listelerini active/exploding bayraklarından yeniden kurar
+void SimParticlesAt(const ParticleSet *particles, float time, float *x, float *y, float *alpha);  // time: levelTime cinsinden
+void SaveWorldState(const GameWorld *world, WorldState *state);
+bool LoadWorldState(GameWorld *world, const WorldState *state);
+uint64_t SimWorldHash(const GameWorld *world);  // Alan alan FNV-1a; yapı boşluklarını içermez
+
+#endif // FLAMING_SIM_H
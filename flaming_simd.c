@@ -0,0 +1,519 @@
+#include "flaming_simd.h"
+#include "flaming_rules.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define FLAMING_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define FLAMING_SIMD_X86 0
+#endif
+
+// Beyaz topa ilk değen ateş topundan sonra top (-1000, -1000)'e taşınır. Ekran
+// dışına çıkmamış bir ateş topu oraya değemeyeceğinden sonraki ateş topları
+// için çarpışma testi yapılmaz; sonuç tek tek denemeyle aynıdır.
+
+// === Skaler ===
+// [first, count) aralığını işler; *hitIndex zaten doluysa çarpışma aranmaz
+static void FireballRange(const SimFireballSpan *span, const SimFireballParams *params, int first, int *hitIndex) {
+    for (int i = first; i < span->count; i++) {
+        if (!span->active[i]) continue;
+
+        Vector2 from = { span->x[i], span->y[i] };
+        span->x[i] += span->velocityX[i] * params->deltaTime;
+        span->y[i] += span->velocityY[i] * params->deltaTime;
+        span->lifeTime[i] += params->deltaTime;
+
+        Vector2 position = { span->x[i], span->y[i] };
+
+        if (SimFireballExpired(position, span->lifeTime[i], params->screenWidth, params->screenHeight)) {
+            span->active[i] = 0;
+            SimFireballSlotClear(span->slots, i);
+            continue;
+        }
+
+        if (*hitIndex < 0 && SimSweptCircleHit(from, position, params->core, params->fireballRadius + params->coreRadius)) {
+            span->active[i] = 0;
+            SimFireballSlotClear(span->slots, i);
+            *hitIndex = i;
+        }
+    }
+}
+
+static float SegmentKernelScalar(const SimSegmentTable *table, const uint16_t *indices, int count, Vector2 from,
+                                 Vector2 displacement, int *hit) {
+    return SimSegmentFirstEnter(table, indices, count, from, displacement, hit);
+}
+
+static void FireballKernelScalar(const SimFireballSpan *span, const SimFireballParams *params, int *hitIndex) {
+    *hitIndex = -1;
+    FireballRange(span, params, 0, hitIndex);
+}
+
+// Uzaklık alanının bir satırı (flaming_sdf.c); [first, count) sütunlarını işler
+static void SdfRowRange(float *row, int first, int count, const SimSdfRowSegment *segment) {
+    for (int c = first; c < count; c++) {
+        float px = (float)c * segment->cellSize - segment->ax;
+        float t = (px * segment->dx + segment->py * segment->dy) * segment->inverseLength2;
+        t = (t > 0.0f) ? t : 0.0f;
+        t = (t < 1.0f) ? t : 1.0f;
+        float ex = px - t * segment->dx;
+        float ey = segment->py - t * segment->dy;
+        float distance2 = ex * ex + ey * ey;
+        row[c] = (distance2 < row[c]) ? distance2 : row[c];
+    }
+}
+
+static void SdfRowKernelScalar(float *row, int count, const SimSdfRowSegment *segment) {
+    SdfRowRange(row, 0, count, segment);
+}
+
+#if FLAMING_SIMD_X86
+// Vektör sürümlerinin ortak sonu: maskelerdeki ateş toplarını kapatır
+static inline void CloseLanes(const SimFireballSpan *span, int first, int expiredMask, int hitMask, int *hitIndex) {
+    while (expiredMask != 0) {
+        int lane = __builtin_ctz((unsigned int)expiredMask);
+        span->active[first + lane] = 0;
+        SimFireballSlotClear(span->slots, first + lane);
+        expiredMask &= expiredMask - 1;
+    }
+
+    if (hitMask != 0 && *hitIndex < 0) {
+        int lane = __builtin_ctz((unsigned int)hitMask);
+        span->active[first + lane] = 0;
+        SimFireballSlotClear(span->slots, first + lane);
+        *hitIndex = first + lane;
+    }
+}
+
+// === SSE2: 4 ateş topu ===
+__attribute__((target("sse2")))
+static void FireballKernelSse2(const SimFireballSpan *span, const SimFireballParams *params, int *hitIndex) {
+    const __m128 deltaTime = _mm_set1_ps(params->deltaTime);
+    const __m128 minX = _mm_set1_ps(-FIREBALL_SCREEN_MARGIN);
+    const __m128 minY = _mm_set1_ps(-FIREBALL_SCREEN_MARGIN);
+    const __m128 maxX = _mm_set1_ps(params->screenWidth + FIREBALL_SCREEN_MARGIN);
+    const __m128 maxY = _mm_set1_ps(params->screenHeight + FIREBALL_SCREEN_MARGIN);
+    const __m128 maxLife = _mm_set1_ps(FIREBALL_LIFETIME);
+    const __m128 coreX = _mm_set1_ps(params->core.x);
+    const __m128 coreY = _mm_set1_ps(params->core.y);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 zeroPs = _mm_setzero_ps();
+    const __m128 onePs = _mm_set1_ps(1.0f);
+    const __m128 four = _mm_set1_ps(4.0f);
+    float radiusSum = params->fireballRadius + params->coreRadius;
+    __m128 hitDistance = _mm_set1_ps(radiusSum * radiusSum);
+    int i = 0;
+
+    *hitIndex = -1;
+
+    for (; i + 4 <= span->count; i += 4) {
+        uint32_t activeBytes;
+        memcpy(&activeBytes, span->active + i, sizeof(activeBytes));
+        if (activeBytes == 0) continue;
+
+        __m128i activeWords = _mm_unpacklo_epi8(_mm_cvtsi32_si128((int)activeBytes), zero);
+        __m128 live = _mm_castsi128_ps(_mm_cmpgt_epi32(_mm_unpacklo_epi16(activeWords, zero), zero));
+
+        __m128 x = _mm_loadu_ps(span->x + i);
+        __m128 y = _mm_loadu_ps(span->y + i);
+        __m128 life = _mm_loadu_ps(span->lifeTime + i);
+        __m128 newX = _mm_add_ps(x, _mm_mul_ps(_mm_loadu_ps(span->velocityX + i), deltaTime));
+        __m128 newY = _mm_add_ps(y, _mm_mul_ps(_mm_loadu_ps(span->velocityY + i), deltaTime));
+        __m128 newLife = _mm_add_ps(life, deltaTime);
+
+        // Yalnızca aktif ateş topları ilerler
+        _mm_storeu_ps(span->x + i, _mm_or_ps(_mm_and_ps(live, newX), _mm_andnot_ps(live, x)));
+        _mm_storeu_ps(span->y + i, _mm_or_ps(_mm_and_ps(live, newY), _mm_andnot_ps(live, y)));
+        _mm_storeu_ps(span->lifeTime + i, _mm_or_ps(_mm_and_ps(live, newLife), _mm_andnot_ps(live, life)));
+
+        __m128 expired = _mm_or_ps(_mm_or_ps(_mm_cmplt_ps(newX, minX), _mm_cmpgt_ps(newX, maxX)),
+                                   _mm_or_ps(_mm_cmplt_ps(newY, minY), _mm_cmpgt_ps(newY, maxY)));
+        expired = _mm_and_ps(_mm_or_ps(expired, _mm_cmpgt_ps(newLife, maxLife)), live);
+
+        // Tick boyunca beyaz topa en yakın geçiş (SimSweptCircleHit); uzak şeritler elenir
+        __m128 sx = _mm_sub_ps(newX, x);
+        __m128 sy = _mm_sub_ps(newY, y);
+        __m128 dx = _mm_sub_ps(coreX, x);
+        __m128 dy = _mm_sub_ps(coreY, y);
+        __m128 length = _mm_add_ps(_mm_mul_ps(sx, sx), _mm_mul_ps(sy, sy));
+        __m128 start = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        __m128 near = _mm_cmple_ps(start, _mm_mul_ps(four, _mm_add_ps(hitDistance, length)));
+        __m128 hit = _mm_andnot_ps(expired, _mm_and_ps(live, near));
+
+        if (_mm_movemask_ps(hit) != 0) {
+            __m128 t = _mm_div_ps(_mm_add_ps(_mm_mul_ps(dx, sx), _mm_mul_ps(dy, sy)), length);
+            t = _mm_and_ps(_mm_cmpgt_ps(length, zeroPs), t);
+            t = _mm_min_ps(_mm_max_ps(t, zeroPs), onePs);
+            __m128 ex = _mm_sub_ps(dx, _mm_mul_ps(sx, t));
+            __m128 ey = _mm_sub_ps(dy, _mm_mul_ps(sy, t));
+            __m128 distance = _mm_add_ps(_mm_mul_ps(ex, ex), _mm_mul_ps(ey, ey));
+            hit = _mm_and_ps(hit, _mm_cmple_ps(distance, hitDistance));
+        }
+
+        int expiredMask = _mm_movemask_ps(expired);
+        int hitMask = _mm_movemask_ps(hit);
+        if ((expiredMask | hitMask) == 0) continue;
+
+        CloseLanes(span, i, expiredMask, hitMask, hitIndex);
+        if (*hitIndex >= 0) hitDistance = _mm_set1_ps(-1.0f);
+    }
+
+    FireballRange(span, params, i, hitIndex);  // Vektöre sığmayan kalan
+}
+
+// Bir vektörün şeritlerini liste sırasıyla tarar; SimSegmentFirstEnter gibi
+// yalnızca daha erken giriş öncekinin yerini alır
+static inline float TakeFirstEnter(const float *enter, int lanes, int first, float best, int *hit) {
+    for (int lane = 0; lane < lanes; lane++) {
+        if (enter[lane] < best) {
+            best = enter[lane];
+            *hit = first + lane;
+        }
+    }
+    return best;
+}
+
+// SSE2'de toplama (gather) komutu yok; dört parça skaler okumayla doldurulur
+__attribute__((target("sse2")))
+static float SegmentKernelSse2(const SimSegmentTable *table, const uint16_t *indices, int count, Vector2 from,
+                               Vector2 displacement, int *hit) {
+    const __m128 fromX = _mm_set1_ps(from.x);
+    const __m128 fromY = _mm_set1_ps(from.y);
+    const __m128 moveX = _mm_set1_ps(displacement.x);
+    const __m128 moveY = _mm_set1_ps(displacement.y);
+    const __m128 signBit = _mm_set1_ps(-0.0f);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 miss = _mm_set1_ps(SIM_SEGMENT_MISS);
+    float first = SIM_SEGMENT_MISS;
+    int k = 0;
+
+    *hit = -1;
+
+    for (; k + 4 <= count; k += 4) {
+        int a = indices[k], b = indices[k + 1], c = indices[k + 2], d = indices[k + 3];
+#define GATHER4(field) _mm_setr_ps(table->field[a], table->field[b], table->field[c], table->field[d])
+        __m128 deltaX = GATHER4(deltaX);
+        __m128 deltaY = GATHER4(deltaY);
+        __m128 limit = GATHER4(limit);
+        __m128 low = GATHER4(low);
+        __m128 high = GATHER4(high);
+        __m128 dxc = _mm_sub_ps(fromX, GATHER4(originX));
+        __m128 dyc = _mm_sub_ps(fromY, GATHER4(originY));
+#undef GATHER4
+        __m128 cross = _mm_sub_ps(_mm_mul_ps(dxc, deltaY), _mm_mul_ps(dyc, deltaX));
+        __m128 crossRate = _mm_sub_ps(_mm_mul_ps(moveX, deltaY), _mm_mul_ps(moveY, deltaX));
+
+        // Dik uzaklık: hareket varsa açık aralık, yoksa nokta testi
+        __m128 t1 = _mm_div_ps(_mm_sub_ps(_mm_xor_ps(limit, signBit), cross), crossRate);
+        __m128 t2 = _mm_div_ps(_mm_sub_ps(limit, cross), crossRate);
+        __m128 crossMoving = _mm_cmpneq_ps(crossRate, zero);
+        __m128 enter = _mm_and_ps(crossMoving, _mm_max_ps(_mm_min_ps(t1, t2), zero));
+        __m128 leave = _mm_or_ps(_mm_and_ps(crossMoving, _mm_min_ps(_mm_max_ps(t1, t2), one)),
+                                 _mm_andnot_ps(crossMoving, one));
+        __m128 ok = _mm_or_ps(_mm_and_ps(crossMoving, _mm_cmplt_ps(enter, leave)),
+                              _mm_andnot_ps(crossMoving, _mm_cmplt_ps(_mm_andnot_ps(signBit, cross), limit)));
+
+        // Baskın eksen
+        __m128 alongY = _mm_castsi128_ps(_mm_setr_epi32(table->axisMask[a], table->axisMask[b],
+                                                        table->axisMask[c], table->axisMask[d]));
+        __m128 coordinate = _mm_or_ps(_mm_and_ps(alongY, fromY), _mm_andnot_ps(alongY, fromX));
+        __m128 rate = _mm_or_ps(_mm_and_ps(alongY, moveY), _mm_andnot_ps(alongY, moveX));
+        t1 = _mm_div_ps(_mm_sub_ps(low, coordinate), rate);
+        t2 = _mm_div_ps(_mm_sub_ps(high, coordinate), rate);
+        __m128 moving = _mm_cmpneq_ps(rate, zero);
+        enter = _mm_or_ps(_mm_and_ps(moving, _mm_max_ps(_mm_min_ps(t1, t2), enter)), _mm_andnot_ps(moving, enter));
+        leave = _mm_or_ps(_mm_and_ps(moving, _mm_min_ps(_mm_max_ps(t1, t2), leave)), _mm_andnot_ps(moving, leave));
+        __m128 inside = _mm_and_ps(_mm_cmple_ps(low, coordinate), _mm_cmple_ps(coordinate, high));
+        ok = _mm_and_ps(ok, _mm_or_ps(moving, inside));
+        ok = _mm_and_ps(ok, _mm_cmple_ps(enter, leave));
+
+        if (_mm_movemask_ps(ok) == 0) continue;
+
+        float lanes[4];
+        _mm_storeu_ps(lanes, _mm_or_ps(_mm_and_ps(ok, enter), _mm_andnot_ps(ok, miss)));
+        first = TakeFirstEnter(lanes, 4, k, first, hit);
+    }
+
+    // Vektöre sığmayan kalan
+    int tailHit;
+    float tail = SimSegmentFirstEnter(table, indices + k, count - k, from, displacement, &tailHit);
+    if (tail < first) {
+        first = tail;
+        *hit = k + tailHit;
+    }
+    return first;
+}
+
+// === AVX2: 8 ateş topu ===
+__attribute__((target("avx2")))
+static void FireballKernelAvx2(const SimFireballSpan *span, const SimFireballParams *params, int *hitIndex) {
+    const __m256 deltaTime = _mm256_set1_ps(params->deltaTime);
+    const __m256 minX = _mm256_set1_ps(-FIREBALL_SCREEN_MARGIN);
+    const __m256 minY = _mm256_set1_ps(-FIREBALL_SCREEN_MARGIN);
+    const __m256 maxX = _mm256_set1_ps(params->screenWidth + FIREBALL_SCREEN_MARGIN);
+    const __m256 maxY = _mm256_set1_ps(params->screenHeight + FIREBALL_SCREEN_MARGIN);
+    const __m256 maxLife = _mm256_set1_ps(FIREBALL_LIFETIME);
+    const __m256 coreX = _mm256_set1_ps(params->core.x);
+    const __m256 coreY = _mm256_set1_ps(params->core.y);
+    const __m256 zeroPs = _mm256_setzero_ps();
+    const __m256 onePs = _mm256_set1_ps(1.0f);
+    const __m256 four = _mm256_set1_ps(4.0f);
+    float radiusSum = params->fireballRadius + params->coreRadius;
+    __m256 hitDistance = _mm256_set1_ps(radiusSum * radiusSum);
+    int i = 0;
+
+    *hitIndex = -1;
+
+    for (; i + 8 <= span->count; i += 8) {
+        uint64_t activeBytes;
+        memcpy(&activeBytes, span->active + i, sizeof(activeBytes));
+        if (activeBytes == 0) continue;
+
+        __m256i activeLanes = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128((long long)activeBytes));
+        __m256 live = _mm256_castsi256_ps(_mm256_cmpgt_epi32(activeLanes, _mm256_setzero_si256()));
+
+        __m256 x = _mm256_loadu_ps(span->x + i);
+        __m256 y = _mm256_loadu_ps(span->y + i);
+        __m256 life = _mm256_loadu_ps(span->lifeTime + i);
+        __m256 newX = _mm256_add_ps(x, _mm256_mul_ps(_mm256_loadu_ps(span->velocityX + i), deltaTime));
+        __m256 newY = _mm256_add_ps(y, _mm256_mul_ps(_mm256_loadu_ps(span->velocityY + i), deltaTime));
+        __m256 newLife = _mm256_add_ps(life, deltaTime);
+
+        // Yalnızca aktif ateş topları ilerler
+        _mm256_storeu_ps(span->x + i, _mm256_blendv_ps(x, newX, live));
+        _mm256_storeu_ps(span->y + i, _mm256_blendv_ps(y, newY, live));
+        _mm256_storeu_ps(span->lifeTime + i, _mm256_blendv_ps(life, newLife, live));
+
+        __m256 expired = _mm256_or_ps(_mm256_or_ps(_mm256_cmp_ps(newX, minX, _CMP_LT_OQ),
+                                                   _mm256_cmp_ps(newX, maxX, _CMP_GT_OQ)),
+                                      _mm256_or_ps(_mm256_cmp_ps(newY, minY, _CMP_LT_OQ),
+                                                   _mm256_cmp_ps(newY, maxY, _CMP_GT_OQ)));
+        expired = _mm256_and_ps(_mm256_or_ps(expired, _mm256_cmp_ps(newLife, maxLife, _CMP_GT_OQ)), live);
+
+        // Tick boyunca beyaz topa en yakın geçiş (SimSweptCircleHit); uzak şeritler elenir
+        __m256 sx = _mm256_sub_ps(newX, x);
+        __m256 sy = _mm256_sub_ps(newY, y);
+        __m256 dx = _mm256_sub_ps(coreX, x);
+        __m256 dy = _mm256_sub_ps(coreY, y);
+        __m256 length = _mm256_add_ps(_mm256_mul_ps(sx, sx), _mm256_mul_ps(sy, sy));
+        __m256 start = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dy, dy));
+        __m256 near = _mm256_cmp_ps(start, _mm256_mul_ps(four, _mm256_add_ps(hitDistance, length)), _CMP_LE_OQ);
+        __m256 hit = _mm256_andnot_ps(expired, _mm256_and_ps(live, near));
+
+        if (_mm256_movemask_ps(hit) != 0) {
+            __m256 t = _mm256_div_ps(_mm256_add_ps(_mm256_mul_ps(dx, sx), _mm256_mul_ps(dy, sy)), length);
+            t = _mm256_and_ps(_mm256_cmp_ps(length, zeroPs, _CMP_GT_OQ), t);
+            t = _mm256_min_ps(_mm256_max_ps(t, zeroPs), onePs);
+            __m256 ex = _mm256_sub_ps(dx, _mm256_mul_ps(sx, t));
+            __m256 ey = _mm256_sub_ps(dy, _mm256_mul_ps(sy, t));
+            __m256 distance = _mm256_add_ps(_mm256_mul_ps(ex, ex), _mm256_mul_ps(ey, ey));
+            hit = _mm256_and_ps(hit, _mm256_cmp_ps(distance, hitDistance, _CMP_LE_OQ));
+        }
+
+        int expiredMask = _mm256_movemask_ps(expired);
+        int hitMask = _mm256_movemask_ps(hit);
+        if ((expiredMask | hitMask) == 0) continue;
+
+        CloseLanes(span, i, expiredMask, hitMask, hitIndex);
+        if (*hitIndex >= 0) hitDistance = _mm256_set1_ps(-1.0f);
+    }
+
+    // Sonraki SSE kodu AVX geçiş cezası ödemesin
+    _mm256_zeroupper();
+    FireballRange(span, params, i, hitIndex);  // Vektöre sığmayan kalan
+}
+__attribute__((target("avx2")))
+static float SegmentKernelAvx2(const SimSegmentTable *table, const uint16_t *indices, int count, Vector2 from,
+                               Vector2 displacement, int *hit) {
+    const __m256 fromX = _mm256_set1_ps(from.x);
+    const __m256 fromY = _mm256_set1_ps(from.y);
+    const __m256 moveX = _mm256_set1_ps(displacement.x);
+    const __m256 moveY = _mm256_set1_ps(displacement.y);
+    const __m256 signBit = _mm256_set1_ps(-0.0f);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 miss = _mm256_set1_ps(SIM_SEGMENT_MISS);
+    float first = SIM_SEGMENT_MISS;
+    int k = 0;
+
+    *hit = -1;
+
+    for (; k + 8 <= count; k += 8) {
+        __m256i lanes = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)(indices + k)));
+#define GATHER8(field) _mm256_i32gather_ps(table->field, lanes, 4)
+        __m256 deltaX = GATHER8(deltaX);
+        __m256 deltaY = GATHER8(deltaY);
+        __m256 limit = GATHER8(limit);
+        __m256 low = GATHER8(low);
+        __m256 high = GATHER8(high);
+        __m256 dxc = _mm256_sub_ps(fromX, GATHER8(originX));
+        __m256 dyc = _mm256_sub_ps(fromY, GATHER8(originY));
+#undef GATHER8
+        __m256 cross = _mm256_sub_ps(_mm256_mul_ps(dxc, deltaY), _mm256_mul_ps(dyc, deltaX));
+        __m256 crossRate = _mm256_sub_ps(_mm256_mul_ps(moveX, deltaY), _mm256_mul_ps(moveY, deltaX));
+
+        // Dik uzaklık: hareket varsa açık aralık, yoksa nokta testi
+        __m256 t1 = _mm256_div_ps(_mm256_sub_ps(_mm256_xor_ps(limit, signBit), cross), crossRate);
+        __m256 t2 = _mm256_div_ps(_mm256_sub_ps(limit, cross), crossRate);
+        __m256 crossMoving = _mm256_cmp_ps(crossRate, zero, _CMP_NEQ_UQ);
+        __m256 enter = _mm256_and_ps(crossMoving, _mm256_max_ps(_mm256_min_ps(t1, t2), zero));
+        __m256 leave = _mm256_blendv_ps(one, _mm256_min_ps(_mm256_max_ps(t1, t2), one), crossMoving);
+        __m256 ok = _mm256_blendv_ps(_mm256_cmp_ps(_mm256_andnot_ps(signBit, cross), limit, _CMP_LT_OQ),
+                                     _mm256_cmp_ps(enter, leave, _CMP_LT_OQ), crossMoving);
+
+        // Baskın eksen
+        __m256 alongY = _mm256_castsi256_ps(_mm256_i32gather_epi32(table->axisMask, lanes, 4));
+        __m256 coordinate = _mm256_blendv_ps(fromX, fromY, alongY);
+        __m256 rate = _mm256_blendv_ps(moveX, moveY, alongY);
+        t1 = _mm256_div_ps(_mm256_sub_ps(low, coordinate), rate);
+        t2 = _mm256_div_ps(_mm256_sub_ps(high, coordinate), rate);
+        __m256 moving = _mm256_cmp_ps(rate, zero, _CMP_NEQ_UQ);
+        enter = _mm256_blendv_ps(enter, _mm256_max_ps(_mm256_min_ps(t1, t2), enter), moving);
+        leave = _mm256_blendv_ps(leave, _mm256_min_ps(_mm256_max_ps(t1, t2), leave), moving);
+        __m256 inside = _mm256_and_ps(_mm256_cmp_ps(low, coordinate, _CMP_LE_OQ),
+                                      _mm256_cmp_ps(coordinate, high, _CMP_LE_OQ));
+        ok = _mm256_and_ps(ok, _mm256_or_ps(moving, inside));
+        ok = _mm256_and_ps(ok, _mm256_cmp_ps(enter, leave, _CMP_LE_OQ));
+
+        if (_mm256_movemask_ps(ok) == 0) continue;
+
+        float enters[8];
+        _mm256_storeu_ps(enters, _mm256_blendv_ps(miss, enter, ok));
+        first = TakeFirstEnter(enters, 8, k, first, hit);
+    }
+
+    // Sonraki SSE kodu AVX geçiş cezası ödemesin
+    _mm256_zeroupper();
+
+    // Vektöre sığmayan kalan
+    int tailHit;
+    float tail = SimSegmentFirstEnter(table, indices + k, count - k, from, displacement, &tailHit);
+    if (tail < first) {
+        first = tail;
+        *hit = k + tailHit;
+    }
+    return first;
+}
+
+// === Uzaklık alanı satırı ===
+// Skalerle aynı işlemler aynı sırayla; sonuç bit bit aynıdır
+__attribute__((target("sse2")))
+static void SdfRowKernelSse2(float *row, int count, const SimSdfRowSegment *segment) {
+    __m128 cellSize = _mm_set1_ps(segment->cellSize);
+    __m128 ax = _mm_set1_ps(segment->ax);
+    __m128 dx = _mm_set1_ps(segment->dx);
+    __m128 dy = _mm_set1_ps(segment->dy);
+    __m128 py = _mm_set1_ps(segment->py);
+    __m128 pyDy = _mm_mul_ps(py, dy);
+    __m128 inverseLength2 = _mm_set1_ps(segment->inverseLength2);
+    __m128 zero = _mm_setzero_ps();
+    __m128 one = _mm_set1_ps(1.0f);
+    __m128i column = _mm_setr_epi32(0, 1, 2, 3);
+    __m128i four = _mm_set1_epi32(4);
+
+    int c = 0;
+    for (; c + 4 <= count; c += 4) {
+        __m128 px = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(column), cellSize), ax);
+        __m128 t = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(px, dx), pyDy), inverseLength2);
+        t = _mm_min_ps(_mm_max_ps(t, zero), one);
+        __m128 ex = _mm_sub_ps(px, _mm_mul_ps(t, dx));
+        __m128 ey = _mm_sub_ps(py, _mm_mul_ps(t, dy));
+        __m128 distance2 = _mm_add_ps(_mm_mul_ps(ex, ex), _mm_mul_ps(ey, ey));
+        _mm_storeu_ps(row + c, _mm_min_ps(distance2, _mm_loadu_ps(row + c)));
+        column = _mm_add_epi32(column, four);
+    }
+
+    SdfRowRange(row, c, count, segment);
+}
+
+
+__attribute__((target("avx2")))
+static void SdfRowKernelAvx2(float *row, int count, const SimSdfRowSegment *segment) {
+    __m256 cellSize = _mm256_set1_ps(segment->cellSize);
+    __m256 ax = _mm256_set1_ps(segment->ax);
+    __m256 dx = _mm256_set1_ps(segment->dx);
+    __m256 dy = _mm256_set1_ps(segment->dy);
+    __m256 py = _mm256_set1_ps(segment->py);
+    __m256 pyDy = _mm256_mul_ps(py, dy);
+    __m256 inverseLength2 = _mm256_set1_ps(segment->inverseLength2);
+    __m256 zero = _mm256_setzero_ps();
+    __m256 one = _mm256_set1_ps(1.0f);
+    __m256i column = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    __m256i eight = _mm256_set1_epi32(8);
+
+    int c = 0;
+    for (; c + 8 <= count; c += 8) {
+        __m256 px = _mm256_sub_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(column), cellSize), ax);
+        __m256 t = _mm256_mul_ps(_mm256_add_ps(_mm256_mul_ps(px, dx), pyDy), inverseLength2);
+        t = _mm256_min_ps(_mm256_max_ps(t, zero), one);
+        __m256 ex = _mm256_sub_ps(px, _mm256_mul_ps(t, dx));
+        __m256 ey = _mm256_sub_ps(py, _mm256_mul_ps(t, dy));
+        __m256 distance2 = _mm256_add_ps(_mm256_mul_ps(ex, ex), _mm256_mul_ps(ey, ey));
+        _mm256_storeu_ps(row + c, _mm256_min_ps(distance2, _mm256_loadu_ps(row + c)));
+        column = _mm256_add_epi32(column, eight);
+    }
+    _mm256_zeroupper();
+
+    SdfRowRange(row, c, count, segment);
+}
+#endif
+
+// === Seçim ===
+SimSimdLevel SimSimdDetect(void) {
+    SimSimdLevel level = SIM_SIMD_SCALAR;
+
+#if FLAMING_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("sse2")) level = SIM_SIMD_SSE2;
+    if (__builtin_cpu_supports("avx2")) level = SIM_SIMD_AVX2;
+#endif
+
+    const char *limit = getenv("FLAMING_SIMD");
+    if (limit != NULL) {
+        if (strcmp(limit, "scalar") == 0) level = SIM_SIMD_SCALAR;
+        else if (strcmp(limit, "sse2") == 0 && level > SIM_SIMD_SSE2) level = SIM_SIMD_SSE2;
+    }
+
+    return level;
+}
+
+const char *SimSimdName(SimSimdLevel level) {
+    switch (level) {
+        case SIM_SIMD_SSE2: return "sse2";
+        case SIM_SIMD_AVX2: return "avx2";
+        default: return "scalar";
+    }
+}
+
+SimFireballKernelFn SimFireballKernel(SimSimdLevel level) {
+#if FLAMING_SIMD_X86
+    if (level == SIM_SIMD_AVX2) return FireballKernelAvx2;
+    if (level == SIM_SIMD_SSE2) return FireballKernelSse2;
+#else
+    (void)level;
+#endif
+    return FireballKernelScalar;
+}
+
+SimSdfRowKernelFn SimSdfRowKernel(SimSimdLevel level) {
+#if FLAMING_SIMD_X86
+    if (level == SIM_SIMD_AVX2) return SdfRowKernelAvx2;
+    if (level == SIM_SIMD_SSE2) return SdfRowKernelSse2;
+#else
+    (void)level;
+#endif
+    return SdfRowKernelScalar;
+}
+
+SimSegmentKernelFn SimSegmentKernel(SimSimdLevel level) {
+#if FLAMING_SIMD_X86
+    if (level == SIM_SIMD_AVX2) return SegmentKernelAvx2;
+    if (level == SIM_SIMD_SSE2) return SegmentKernelSse2;
+#else
+    (void)level;
+#endif
+    return SegmentKernelScalar;
+}
@@ -0,0 +1,74 @@
+#ifndef FLAMING_SIMD_H
+#define FLAMING_SIMD_H
+
+// Toplu motorun ve uzaklık alanının (flaming_sdf.h) vektör çekirdekleri.
+// x86'da SSE2 ve AVX2 sürümleri derlenir ve hangisinin kullanılacağı çalışma
+// anında işlemciye bakılarak seçilir; diğer mimarilerde skaler sürüm çalışır.
+// Tüm sürümler skaler kodla aynı kayan nokta işlemlerini aynı sırayla yapar
+// (FMA kullanılmaz), bu yüzden sonuçlar bit bit aynıdır. Oyun -march=native
+// gibi FMA açan bir seçenekle derlenirse -ffp-contract=off da verilmelidir.
+//
+// FLAMING_SIMD ortam değişkeni (scalar, sse2, avx2) seçilebilecek en yüksek
+// düzeyi sınırlar; sürümleri karşılaştırmak için kullanılır.
+
+#include "flaming_sim.h"
+#include <stdint.h>
+
+typedef enum {
+    SIM_SIMD_SCALAR,
+    SIM_SIMD_SSE2,
+    SIM_SIMD_AVX2
+} SimSimdLevel;
+
+// Bir dünyanın SoA ateş topu dilimi
+typedef struct {
+    float *x;
+    float *y;
+    const float *velocityX;
+    const float *velocityY;
+    float *lifeTime;
+    uint8_t *active;
+    uint64_t *slots;  // Aktif slotların bit haritası (GameWorld::fireballSlots)
+    int count;
+} SimFireballSpan;
+
+typedef struct {
+    float deltaTime;  // dt * timeScale
+    Vector2 core;
+    float fireballRadius;
+    float coreRadius;
+    float screenWidth;
+    float screenHeight;
+} SimFireballParams;
+
+// Aktif ateş toplarını ilerletir, ekran dışına çıkan ya da ömrü dolanları ve
+// tick boyunca beyaz topa değen ilkini kapatır (UpdateFireballs); kapatılanların
+// bitleri span->slots'tan silinir. *hitIndex beyaz topa değen ateş topu ya da -1 olur.
+typedef void (*SimFireballKernelFn)(const SimFireballSpan *span, const SimFireballParams *params, int *hitIndex);
+
+// from'dan displacement kadar giden noktanın indices'teki doğru parçalarından
+// ilk girdiğinin anını döndürür; *hit liste içindeki sırası ya da -1 (SimSegmentFirstEnter)
+typedef float (*SimSegmentKernelFn)(const SimSegmentTable *table, const uint16_t *indices, int count, Vector2 from,
+                                    Vector2 displacement, int *hit);
+
+// Uzaklık alanı (flaming_sdf.h) satırındaki bir duvar ekseni
+typedef struct {
+    float cellSize;
+    float ax;              // Parçanın başı; x düğüm koordinatından çıkarılır
+    float py;              // Satırın y'si - parçanın başının y'si
+    float dx;
+    float dy;
+    float inverseLength2;  // Parça noktaysa 0
+} SimSdfRowSegment;
+
+// row[c] = min(row[c], (c * cellSize, satır y) düğümünün parçaya uzaklığının karesi)
+typedef void (*SimSdfRowKernelFn)(float *row, int count, const SimSdfRowSegment *segment);
+
+// === Fonksiyon prototipleri ===
+SimSimdLevel SimSimdDetect(void);
+const char *SimSimdName(SimSimdLevel level);
+SimFireballKernelFn SimFireballKernel(SimSimdLevel level);
+SimSegmentKernelFn SimSegmentKernel(SimSimdLevel level);
+SimSdfRowKernelFn SimSdfRowKernel(SimSimdLevel level);
+
+#endif // FLAMING_SIMD_H